@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cassert>
+#include <set>
 
 namespace Machine
 {
@@ -1210,10 +1211,7 @@ namespace Machine
                         s = "--";
                     else
                     {
-                        auto it = console_.halted_machines_.find((**console_.focus()).output());
-                        if (it == std::cend(console_.halted_machines_))
-                            abort("console_t::tui_t::machines_t::machines_t(console_t &)");
-                        s = std::to_string(std::size(it->second));
+                        s = std::to_string(console_.output_count((**console_.focus()).output()));
                     }
                 return text(s); })
         });
@@ -1624,7 +1622,8 @@ namespace Machine
     {
         pause_ = true;
 
-        wait();
+        if (future_.valid())
+            future_.wait();
 
         console_constructed_ = false;
         return;
@@ -1669,9 +1668,9 @@ namespace Machine
 
     console_t &console_t::step()
     {
-        wait();
+        settle();
 
-        future_ = std::async(std::launch::async, [this]
+        future_ = launch([this]
             {
                 {
                     std::lock_guard lock{mutex_};
@@ -1681,13 +1680,8 @@ namespace Machine
                     if (*focus_ and (**focus_).state() == machine_t::machine_state_t::running)
                         step(running_machines_, focus_, new_halted, blocked_machines_);
 
-                    for (auto i = std::cbegin(new_halted); i != std::cend(new_halted);)
-                    {
-                        auto j = i;
-                        ++i;
-                        list_t &l = halted_machines_[(*j)->output()];
-                        l.splice(std::cend(l), new_halted, j);
-                    }
+                    store(new_halted);
+                    results_.drain(halted_machines_);
                 }
             
                 tui().applicable_instructions().update();
@@ -1698,9 +1692,9 @@ namespace Machine
 
     console_t &console_t::run()
     {
-        wait();
+        settle();
 
-        future_ = std::async(std::launch::async, [this]
+        future_ = launch([this]
             {
                 {
                     std::lock_guard lock{mutex_};
@@ -1713,13 +1707,8 @@ namespace Machine
                            (**focus_).state() == machine_t::machine_state_t::running)
                         step(running_machines_, focus_, new_halted, blocked_machines_);
 
-                    for (auto i = std::cbegin(new_halted); i != std::cend(new_halted);)
-                    {
-                        auto j = i;
-                        ++i;
-                        list_t &l = halted_machines_[(*j)->output()];
-                        l.splice(std::cend(l), new_halted, j);
-                    }
+                    store(new_halted);
+                    results_.drain(halted_machines_);
                 }
 
                 tui().applicable_instructions().update();
@@ -1730,75 +1719,18 @@ namespace Machine
 
     console_t &console_t::step_all()
     {
-        wait();
+        settle();
 
-        future_ = std::async(std::launch::async, [this]
+        future_ = launch([this]
             {
                 {
                     std::lock_guard lock{mutex_};
 
                     pause_ = false;
 
-                    std::vector<std::thread> threads;
-                    
-                    index_t s = std::size(running_machines_);
-                    index_t a = s / n_threads_;
-                    index_t b = s % n_threads_;
-
-                    std::vector<list_t> lists(3 * n_threads_);
-
-                    for (index_t i = 0; i != n_threads_; ++i)
-                    {
-                        if (not a and not b)
-                            break;
-
-                        it_t c = std::begin(running_machines_);
-                        it_t d = std::next(c, a);
-                        if (b != 0)
-                        {
-                            --b;
-                            ++d;
-                        }
-
-                        lists[3 * i].splice(std::cend(lists[3 * i]), running_machines_, c, d);
-                        threads.emplace_back(
-                            [&running = lists[3 * i], &halted = lists[3 * i + 1],
-                             &blocked = lists[3 * i + 2], &p = pause_, this]
-                            {
-                                auto last = std::end(running);
-                                --last;
-
-                                for (auto it = std::begin(running); it != last and not p;)
-                                {
-                                    auto next = std::next(it);
-                                    step(running, it, halted, blocked);
-                                    it = next;
-                                }
-
-                                if (not p)
-                                    step(running, last, halted, blocked);
-
-                                return;
-                            });
-                    }
-
-                    for (index_t i = 0; i != std::size(threads); ++i)
-                    {
-                        threads[i].join();
-
-                        running_machines_.splice(std::cend(running_machines_), lists[3 * i]);
-                        blocked_machines_.splice(std::cend(blocked_machines_), lists[3 * i + 2]);
-
-                        list_t &a = lists[3 * i + 1];
-
-                        for (auto j = std::cbegin(a); j != std::cend(a);)
-                        {
-                            auto k = j;
-                            ++j;
-                            list_t &l = halted_machines_[(*k)->output()];
-                            l.splice(std::cend(l), a, k);
-                        }
-                    }
+                    distribute();
+                    pool_.run([this](index_t i) { work(i, 1, true); });
+                    collect();
                 }
 
                 tui().applicable_instructions().update();
@@ -1809,83 +1741,65 @@ namespace Machine
 
     console_t &console_t::run_all()
     {
-        wait();
+        settle();
 
-        future_ = std::async(std::launch::async, [this]
+        future_ = launch([this]
             {
                 {
                     std::lock_guard lock{mutex_};
 
                     pause_ = false;
 
-                    while (not pause_ and not std::empty(running_machines_) and
-                           not (pause_halt_ and not std::empty(halted_machines_)))
-                    {
-                        std::vector<std::thread> threads;
-                        
-                        index_t s = std::size(running_machines_);
-                        index_t a = s / n_threads_;
-                        index_t b = s % n_threads_;
+                    if (strategy_ == strategy_t::iterative_deepening)
+                        deepen();
 
-                        std::vector<list_t> lists(3 * n_threads_);
+                    else if (strategy_ != strategy_t::breadth_first or not pause_halt_)
+                        explore();
 
-                        for (index_t i = 0; i != n_threads_; ++i)
+                    else
+                        while (not pause_ and not std::empty(running_machines_) and
+                               std::empty(halted_machines_))
                         {
-                            if (not a and not b)
-                                break;
+                            distribute();
+                            pool_.run([this](index_t i) { work(i, 1, true); });
+                            collect();
+                        }
+                }
 
-                            it_t c = std::begin(running_machines_);
-                            it_t d = std::next(c, a);
-                            if (b != 0)
-                            {
-                                --b;
-                                ++d;
-                            }
+                tui().applicable_instructions().update();
 
-                            lists[3 * i].splice(std::cend(lists[3 * i]), running_machines_, c, d);
-                            threads.emplace_back(
-                                [&running = lists[3 * i], &halted = lists[3 * i + 1],
-                                 &blocked = lists[3 * i + 2], &p = pause_, this]
-                                {
-                                    auto last = std::end(running);
-                                    --last;
+                return;
+            });
 
-                                    for (auto it = std::begin(running); it != last and not p;)
-                                    {
-                                        auto next = std::next(it);
-                                        step(running, it, halted, blocked);
-                                        it = next;
-                                    }
+        return *this;
+    }
 
-                                    if (not p)
-                                        step(running, last, halted, blocked);
+    console_t &console_t::run_batch(std::vector<std::string> inputs)
+    {
+        settle();
 
-                                    return;
-                                });
-                        }
+        future_ = launch([this, inputs = std::move(inputs)]
+            {
+                std::lock_guard lock{mutex_};
 
-                        for (index_t i = 0; i != std::size(threads); ++i)
-                        {
-                            threads[i].join();
+                batch_.clear();
 
-                            running_machines_.splice(std::cend(running_machines_), lists[3 * i]);
-                            blocked_machines_.splice(std::cend(blocked_machines_),
-                                lists[3 * i + 2]);
+                if (not (state_ & console_state_t::program_loaded))
+                    return;
 
-                            list_t &a = lists[3 * i + 1];
+                pause_ = false;
+                batch_.assign(std::size(inputs), {machine_t::machine_state_t::running, {}});
 
-                            for (auto j = std::cbegin(a); j != std::cend(a);)
-                            {
-                                auto k = j;
-                                ++j;
-                                list_t &l = halted_machines_[(*k)->output()];
-                                l.splice(std::cend(l), a, k);
-                            }
-                        }
-                    }
-                }
+                const machine_t &prototype = **focus_;
+                std::atomic<index_t> next{0};
 
-                tui().applicable_instructions().update();
+                pool_.run([&] (index_t)
+                    {
+                        for (index_t i = next++; i < std::size(inputs) and not pause_; i = next++)
+                            batch_[i] = evaluate(prototype, inputs[i]);
+
+                        return;
+                    });
 
                 return;
             });
@@ -1896,6 +1810,7 @@ namespace Machine
     console_t &console_t::pause()
     {
         pause_ = true;
+        pool_.notify();
         return *this;
     }
 
@@ -1928,13 +1843,40 @@ namespace Machine
         return std::cbegin(halted_machines_)->first == arg;
     }
 
+    auto console_t::batch_output() const -> const std::vector<batch_result_t> &
+        { return batch_; }
+
     void console_t::wait()
     {
         if (future_.valid())
-            future_.wait();
+            future_.get();
+        return;
+    }
+
+    void console_t::settle() noexcept
+    {
+        // The job already reported its error in the menu
+        if (future_.valid())
+            try { future_.get(); }
+            catch (...) {}
         return;
     }
 
+    std::future<void> console_t::launch(std::function<void()> job)
+    {
+        return std::async(std::launch::async, [this, job = std::move(job)]
+            {
+                try { job(); }
+                catch (std::exception &e)
+                {
+                    *tui().menu().strings()[0] = std::string{"The simulation failed: "} + e.what();
+                    throw;
+                }
+
+                return;
+            });
+    }
+
     std::vector<std::vector<std::string>> console_t::output() const
     {
         std::vector<std::vector<std::string>> ret;
@@ -1948,18 +1890,108 @@ namespace Machine
 
     std::atomic<bool> &console_t::pause_halt() { return pause_halt_;}
 
+    std::atomic<bool> &console_t::deduplicate() { return deduplicate_; }
+
+    std::atomic<index_t> &console_t::quantum() { return quantum_; }
+
+    std::atomic<bool> &console_t::retain_halted() { return retain_halted_; }
+
+    index_t console_t::output_count(const std::vector<std::string> &arg)
+        { return results_.count(arg); }
+
+    std::vector<std::string> console_t::print_fusions()
+    {
+        std::lock_guard lock{mutex_};
+
+        if (not *focus_)
+            return {};
+
+        return (**focus_).print_fusions();
+    }
+
+    console_t &console_t::search_output(std::string arg)
+    {
+        return search_predicate([arg = std::move(arg)](const machine_t &m)
+            { return std::ranges::find(m.output(), arg) != std::cend(m.output()); });
+    }
+
+    console_t &console_t::search_output(std::vector<std::string> arg)
+    {
+        return search_predicate([arg = std::move(arg)](const machine_t &m)
+            { return m.output() == arg; });
+    }
+
+    console_t &console_t::search_predicate(std::function<bool(const machine_t &)> arg)
+    {
+        settle();
+        search_predicate_ = std::move(arg);
+        return *this;
+    }
+
+    console_t &console_t::search_classes(index_t arg)
+    {
+        settle();
+        search_classes_ = arg;
+        return *this;
+    }
+
+    console_t &console_t::search_all()
+    {
+        settle();
+        search_predicate_ = nullptr;
+        search_classes_ = 0;
+        return *this;
+    }
+
+    console_t &console_t::strategy(strategy_t arg)
+    {
+        strategy_ = arg;
+        return *this;
+    }
+
+    console_t &console_t::priority(std::function<index_t(const machine_t &)> arg)
+    {
+        settle();
+        priority_ = std::move(arg);
+        return *this;
+    }
+
+    std::atomic<index_t> &console_t::depth_bound() { return depth_bound_; }
+
+    std::atomic<index_t> &console_t::frontier_cap() { return frontier_cap_; }
+
+    std::atomic<index_t> &console_t::memory_budget() { return memory_budget_; }
+
+    console_t &console_t::overflow(overflow_t arg)
+    {
+        overflow_ = arg;
+        return *this;
+    }
+
+    index_t console_t::spilled_counter() const { return spilled_counter_; }
+
+    index_t console_t::dropped_counter() const { return dropped_counter_; }
+
+    index_t console_t::pruned_counter() const { return pruned_counter_; }
+
     void console_t::clear() noexcept
     {
         pause_ = true;
-        wait();
+        settle();
         invalid_machines_.clear();
         running_machines_.clear();
         halted_machines_.clear();
         blocked_machines_.clear();
+        results_.clear();
+        spill_.clear();
         focus_ = std::begin(null_list_);
         pause_ = false;
         state_ = console_state_t::empty;
         instruction_counter_ = 0;
+        pruned_counter_ = 0;
+        spilled_counter_ = 0;
+        dropped_counter_ = 0;
+        visited_.clear();
         strings_.resize(2);
         strings_[0]->clear();
         strings_[1]->clear();
@@ -1998,6 +2030,8 @@ namespace Machine
         running_machines_.clear();
         halted_machines_.clear();
         blocked_machines_.clear();
+        results_.clear();
+        spill_.clear();
 
         temp->initialise("");
         switch(temp->state())
@@ -2016,9 +2050,10 @@ namespace Machine
             }
             case (machine_t::machine_state_t::halted):
             {
-                const std::vector<std::string> &o = temp->output();
-                list_t &l = halted_machines_[o];
+                list_t l;
                 focus_ = l.insert(std::cend(l), std::move(temp));
+                results_.insert(l, focus_, true);
+                results_.drain(halted_machines_);
                 break;
             }
             case (machine_t::machine_state_t::blocked):
@@ -2034,24 +2069,31 @@ namespace Machine
             (*focus_)->deterministic());
 
         instruction_counter_ = 0;
+        pruned_counter_ = 0;
+        spilled_counter_ = 0;
+        dropped_counter_ = 0;
+        visited_.clear();
 
         return;
     }
 
-    void console_t::step(list_t &list, it_t it, list_t &halted, list_t &blocked)
+    bool console_t::step(list_t &list, it_t it, list_t &halted, list_t &blocked, index_t steps)
     {
         if (not *it)
-            abort("console_t::step(list_t &, it_t, list_t &, list_t &)");
+            abort("console_t::step(list_t &, it_t, list_t &, list_t &, index_t)");
 
         machine_t &m = **it;
         machine_t::machine_state_t s = m.state();
         
         if (s != machine_t::machine_state_t::running)
-            return;
+            return false;
 
         index_t n = m.n_applicable_instructions();
 
-        if (n != 0)
+        if (n != 0 and steps > 1 and m.deterministic())
+            instruction_counter() += m.advance(steps);
+
+        else if (n != 0)
         {
             index_t sel = m.selected_instruction();
             if (sel == negative_1)
@@ -2072,8 +2114,11 @@ namespace Machine
                     halted.emplace_back(std::move(a));
                 else if (a->state() == machine_t::machine_state_t::blocked)
                     blocked.emplace_back(std::move(a));
-                else
+                else if (not deduplicate_ or
+                         visited_.insert(a->configuration(), a->computation_size()))
                     list.emplace_back(std::move(a));
+                else
+                    ++pruned_counter_;
             }
             
             m.select_instruction(sel);
@@ -2089,132 +2134,985 @@ namespace Machine
         else if (s == machine_t::machine_state_t::blocked)
             blocked.splice(std::cend(blocked), list, it);
 
-        return;
+        else if (deduplicate_ and not visited_.insert(m.configuration(), m.computation_size()) and
+                 it != focus_)
+        {
+            list.erase(it);
+            ++pruned_counter_;
+        }
+
+        else
+            return true;
+
+        return false;
     }
 
-    std::string console_t::load_program()
+    void console_t::work(index_t w, index_t quantum, bool rounds)
     {
-        std::string ret;
-        std::lock_guard lock{mutex_};
-
+        try
         {
-            bool error_in_loading = true;
+            pool_t::worker_t &worker = pool_.worker(w);
+            list_t local;
 
-            try
+            while (not pause_)
             {
-                std::ifstream stream{*program_name()};
-                ptr_t new_machine = std::make_shared<machine_t>(stream);
+                const index_t signal = pool_.signal();
 
-                if (not new_machine or new_machine->state() != machine_t::machine_state_t::invalid)
-                    abort("console_t::load_program()");
+                if (not pool_.pop(w, local))
+                {
+                    if (rounds)
+                        break;
 
-                error_in_loading = false;
+                    bool done = false;
 
-                clear();
+                    // The spill is refilled under the lock of the pool, so that no other worker
+                    // sees an empty frontier while the machines are moved out of the spill
+                    pool_.park(signal, [&]
+                        {
+                            if (pause_)
+                                return done = true;
+                            if (pending_ != 0)
+                                return false;
 
-                invalid_machines_ = {std::move(new_machine)};
-                focus_ = std::begin(invalid_machines_);
+                            pending_ += spill_.pop(local, std::max(index_t{1}, capacity_ / 2));
+                            done = std::empty(local);
 
-                state_ = static_cast<console_state_t>(console_state_t::program_loaded |
-                    (*focus_)->deterministic());
-            }
+                            return true;
+                        });
 
-            catch (std::runtime_error &e)
-            {
-                ret = e.what();
-                *tui().menu().strings()[0] = "Error loading the program.";
+                    if (done)
+                        break;
 
-                if (not error_in_loading)
+                    if (not std::empty(local))
+                        pool_.push(w, local);
+
+                    continue;
+                }
+
+                it_t it = std::begin(local);
+                bool running = true;
+                index_t forks = 0;
+
+                for (index_t i = 0; i != quantum and running and not pause_; ++i)
                 {
-                    clear();
-                    tui().update_all();
+                    index_t n = std::size(local);
+
+                    if ((**it).computation_size() >= bound_)
+                    {
+                        worker.next_.splice(std::cend(worker.next_), local, it);
+                        running = false;
+                    }
+                    else
+                        running = step(local, it, worker.halted_, worker.blocked_, rounds ? 1 :
+                            std::min(bound_ - (**it).computation_size(),
+                                     machine_t::max_unbounded_steps));
+
+                    forks += std::size(local) + (running ? 0 : 1) - n;
                 }
 
-                return ret;
-            }
+                store(worker.halted_);
 
-            if (*focus_)
-                for (index_t i = 0; i != std::size((*focus_)->devices()); ++i)
+                if (rounds)
                 {
-                    tui().devices().input_strings().emplace_back(std::make_shared<std::string>());
-                    strings_.emplace_back(std::make_shared<std::string>());
-                    tui().menu().strings().emplace_back(strings_.back());
+                    worker.next_.splice(std::cend(worker.next_), local);
+                    --pending_;
                 }
+                else
+                {
+                    if (forks != 0)
+                        pending_ += forks;
+                    if (not running)
+                        --pending_;
 
-            *tui().menu().strings()[0] = "Program loaded.";
-            tui().menu().tab_selected() = 0;
+                    if (pending_ > capacity_)
+                    {
+                        const index_t n = std::size(local);
+                        overflow(local);
+                        pending_ -= n;
+                    }
+
+                    pool_.push(w, local);
+                }
+            }
         }
 
-        tui().update_all();
+        catch (...)
+        {
+            pause_ = true;
+            pool_.notify();
+            throw;
+        }
 
-        return ret;
+        pool_.notify();
+
+        return;
     }
 
-    void console_t::initialise_all()
+    void console_t::explore()
     {
-        {
-            std::lock_guard lock{mutex_};
+        if (strategy_ == strategy_t::depth_first)
+            bound_ = depth_bound_.load();
+        if (strategy_ == strategy_t::best_first)
+            pool_.order(priority_ ? priority_ : [](const machine_t &m)
+                { return m.computation_size(); });
 
-            reset();
+        distribute();
+        pool_.run([this, q = std::max(index_t{1}, quantum_.load())](index_t i)
+            { work(i, q, false); });
+        collect();
 
-            const std::string &s = *initialiser_string();
+        pool_.order(nullptr);
+        bound_ = negative_1;
 
-            (*focus_)->initialise(s);
+        return;
+    }
 
-            if ((**focus_).state() == machine_t::machine_state_t::running)
-            {
-                running_machines_.splice(std::cend(running_machines_), invalid_machines_);
-                running_machines_.splice(std::cend(running_machines_), blocked_machines_);
+    void console_t::deepen()
+    {
+        list_t roots;
+        roots.splice(std::cend(roots), running_machines_);
 
-                for (auto &i : halted_machines_)
-                    running_machines_.splice(std::cend(running_machines_), i.second);
+        const index_t limit = depth_bound_;
 
-                if (std::size(running_machines_) != 1)
-                    abort("console_t::initialise_all()");
+        for (index_t d = std::min(index_t{1}, limit);; d = std::min(2 * d, limit))
+        {
+            for (const auto &i : roots)
+                running_machines_.emplace_back(std::make_shared<machine_t>(*i));
 
-                focus_ = std::begin(running_machines_);
-            }
-            else if ((**focus_).state() == machine_t::machine_state_t::blocked)
-            {
-                blocked_machines_.splice(std::cend(blocked_machines_), invalid_machines_);
-                blocked_machines_.splice(std::cend(blocked_machines_), running_machines_);
+            bound_ = d;
+            visited_.clear();
 
-                for (auto &i : halted_machines_)
-                    blocked_machines_.splice(std::cend(running_machines_), i.second);
+            distribute();
+            pool_.run([this, q = std::max(index_t{1}, quantum_.load())](index_t i)
+                { work(i, q, false); });
+            collect();
 
-                if (std::size(blocked_machines_) != 1)
-                    abort("console_t::initialise_all()");
+            recorded_depth_ = d;
+
+            if (pause_ or std::empty(running_machines_) or d == limit)
+                break;
+
+            running_machines_.clear();
+            spill_.clear();
+        }
 
+        bound_ = negative_1;
+        recorded_depth_ = 0;
+
+        for (auto i = std::begin(roots); i != std::end(roots); ++i)
+        {
+            if (i != focus_)
+                continue;
+
+            if (not std::empty(running_machines_))
+                focus_ = std::begin(running_machines_);
+            else if (not std::empty(halted_machines_))
+                focus_ = std::begin(std::begin(halted_machines_)->second);
+            else if (not std::empty(blocked_machines_))
                 focus_ = std::begin(blocked_machines_);
-            }
             else
-                abort("console_t::initialise_all()");
-
-            for (index_t i = 0; i != std::size((*focus_)->devices()); ++i)
-                *(tui().devices().input_strings()[i]) = s;
+                focus_ = std::begin(null_list_);
 
-            state_ = static_cast<console_state_t>((*focus_)->deterministic() |
-                    console_state_t::program_loaded | console_state_t::running);
+            break;
         }
 
-        tui().applicable_instructions().update();
+        return;
+    }
+
+    void console_t::distribute()
+    {
+        const index_t n = pool_.size();
+
+        pending_ = std::size(running_machines_);
+
+        if (memory_budget_ != negative_1 and not std::empty(running_machines_))
+            capacity_ = std::min(frontier_cap_.load(), std::max(index_t{1},
+                memory_budget_ / running_machines_.front()->footprint()));
+        else
+            capacity_ = frontier_cap_.load();
+
+        for (index_t i = 0; not std::empty(running_machines_); i = (i + 1) % n)
+        {
+            list_t l;
+            l.splice(std::cend(l), running_machines_, std::begin(running_machines_));
+            pool_.push(i, l);
+        }
 
         return;
     }
 
-    void console_t::initialise_individually()
+    void console_t::collect()
     {
+        pool_.drain(running_machines_);
+
+        for (index_t i = 0; i != pool_.size(); ++i)
         {
-            std::lock_guard lock{mutex_};
+            pool_t::worker_t &worker = pool_.worker(i);
 
-            reset();
+            running_machines_.splice(std::cend(running_machines_), worker.next_);
 
-            std::vector<std::string> input;
-            for (index_t i = 0; i != std::size((*focus_)->devices()); ++i)
+            list_t &a = worker.blocked_;
+
+            for (auto j = std::begin(a); j != std::end(a);)
             {
-                const std::string &s = *initialiser_string_vector(i);
-                input.emplace_back(s);
-                *(tui().devices().input_strings()[i]) = s;
+                auto k = j;
+                ++j;
+                if ((*k)->computation_size() <= recorded_depth_ and k != focus_)
+                    a.erase(k);
+            }
+
+            blocked_machines_.splice(std::cend(blocked_machines_), a);
+        }
+
+        results_.drain(halted_machines_);
+        pending_ = 0;
+
+        balance();
+
+        return;
+    }
+
+    void console_t::overflow(list_t &list)
+    {
+        for (auto i = std::begin(list); i != std::end(list);)
+        {
+            auto j = i;
+            ++i;
+
+            if (j == focus_)
+            {
+                ++pending_;
+                continue;
+            }
+
+            if (overflow_ == overflow_t::spill)
+            {
+                spill_.push(*j);
+                ++spilled_counter_;
+            }
+            else
+                ++dropped_counter_;
+
+            list.erase(j);
+        }
+
+        return;
+    }
+
+    void console_t::balance()
+    {
+        const index_t n = std::size(running_machines_);
+
+        if (n > capacity_)
+        {
+            list_t excess;
+            excess.splice(std::cend(excess), running_machines_,
+                std::next(std::begin(running_machines_), capacity_), std::end(running_machines_));
+            overflow(excess);
+            running_machines_.splice(std::cend(running_machines_), excess);
+        }
+        else if (n < capacity_ / 2 and std::size(spill_) != 0)
+            spill_.pop(running_machines_, capacity_ - n);
+
+        pending_ = 0;
+
+        return;
+    }
+
+    auto console_t::evaluate(const machine_t &prototype, const std::string &input) ->
+        batch_result_t
+    {
+        batch_result_t ret{machine_t::machine_state_t::invalid, {}};
+        std::set<std::vector<std::string>> outputs;
+        std::unordered_set<std::vector<index_t>> visited;
+        std::vector<machine_t> current;
+        std::vector<machine_t> next;
+        const index_t bound = depth_bound_;
+        bool found = false;
+        bool cut = false;
+
+        current.emplace_back(prototype);
+
+        try { current.back().initialise(input); }
+        catch (std::runtime_error &) { return ret; }
+
+        ret.state_ = machine_t::machine_state_t::running;
+
+        // The inputs are evaluated concurrently, so each of them gets a share of the memory budget.
+        // Without a cap the frontier of an input that never halts would grow forever.
+        index_t cap = frontier_cap_;
+        if (memory_budget_ != negative_1)
+            cap = std::min(cap, std::max(index_t{1},
+                memory_budget_ / (pool_.size() * current.back().footprint())));
+        if (cap == negative_1)
+            cap = batch_frontier_cap_;
+
+        auto classify = [&] (machine_t &&m, index_t steps)
+        {
+            instruction_counter_ += steps;
+
+            if (m.state() == machine_t::machine_state_t::halted)
+            {
+                found = found or (search_predicate_ and search_predicate_(m));
+                outputs.emplace(m.output());
+            }
+            else if (m.state() == machine_t::machine_state_t::running and
+                     (not deduplicate_ or visited.insert(m.configuration()).second))
+                next.emplace_back(std::move(m));
+
+            return;
+        };
+
+        if (current.back().state() != machine_t::machine_state_t::running)
+            current.clear();
+
+        // Breadth-first, so that every machine of a round has taken the same number of steps
+        while (not std::empty(current))
+        {
+            if (pause_)
+                return ret;
+
+            for (machine_t &m : current)
+            {
+                if (m.computation_size() >= bound)
+                {
+                    cut = true;
+                    continue;
+                }
+
+                if (m.deterministic())
+                {
+                    const index_t steps = m.advance(
+                        std::min(bound - m.computation_size(), machine_t::max_unbounded_steps));
+                    classify(std::move(m), steps);
+                    continue;
+                }
+
+                index_t n = m.n_applicable_instructions();
+
+                if (n == 0)
+                    continue;
+
+                for (index_t i = 1; i < n; ++i)
+                {
+                    machine_t a{m};
+                    a.select_instruction(i);
+                    a.next();
+                    classify(std::move(a), 1);
+                }
+
+                m.select_instruction(0);
+                m.next();
+                classify(std::move(m), 1);
+            }
+
+            if (found or (pause_halt_ and not std::empty(outputs)) or
+                (search_classes_ != 0 and std::size(outputs) >= search_classes_))
+                break;
+
+            if (std::size(next) > cap)
+            {
+                if (overflow_ == overflow_t::spill)
+                    return ret;
+
+                dropped_counter_ += std::size(next) - cap;
+                next.erase(std::next(std::begin(next), cap), std::end(next));
+                cut = true;
+            }
+
+            current.swap(next);
+            next.clear();
+        }
+
+        if (cut and std::empty(outputs))
+            return ret;
+
+        ret.state_ = std::empty(outputs) ? machine_t::machine_state_t::blocked :
+            machine_t::machine_state_t::halted;
+        ret.output_.assign(std::begin(outputs), std::end(outputs));
+
+        return ret;
+    }
+
+    void console_t::store(list_t &halted)
+    {
+        for (auto i = std::begin(halted); i != std::end(halted);)
+        {
+            auto j = i;
+            ++i;
+
+            if ((*j)->computation_size() <= recorded_depth_ and j != focus_)
+            {
+                halted.erase(j);
+                continue;
+            }
+
+            bool found = search_predicate_ and search_predicate_(**j);
+
+            results_.insert(halted, j, retain_halted_ or found or j == focus_);
+
+            if (found or (search_classes_ != 0 and results_.size() >= search_classes_) or
+                (pause_halt_ and strategy_ != strategy_t::breadth_first))
+                pause_ = true;
+        }
+
+        return;
+    }
+
+    void console_t::results_t::insert(list_t &list, it_t it, bool retain)
+    {
+        const std::vector<std::string> &output = (*it)->output();
+        const std::size_t h = hash(output);
+        shard_t &shard = shards_[h % n_shards_];
+        std::lock_guard lock{shard.mutex_};
+
+        auto c = shard.map_.find(key_view_t{h, output});
+        if (c == std::end(shard.map_))
+        {
+            c = shard.map_.emplace(key_t{h, output}, class_t{}).first;
+            ++size_;
+        }
+
+        class_t &a = c->second;
+
+        if (retain or a.count_ == 0)
+        {
+            if (std::empty(a.new_))
+                shard.dirty_.emplace_back(&c->first, &a);
+            a.new_.splice(std::cend(a.new_), list, it);
+        }
+        else
+            list.erase(it);
+
+        ++a.count_;
+
+        return;
+    }
+
+    void console_t::results_t::drain(std::map<std::vector<std::string>, list_t> &map)
+    {
+        for (shard_t &i : shards_)
+        {
+            std::lock_guard lock{i.mutex_};
+
+            for (auto [key, a] : i.dirty_)
+            {
+                list_t &l = map[key->output_];
+                l.splice(std::cend(l), a->new_);
+            }
+
+            i.dirty_.clear();
+        }
+
+        return;
+    }
+
+    index_t console_t::results_t::count(const std::vector<std::string> &output)
+    {
+        const std::size_t h = hash(output);
+        shard_t &shard = shards_[h % n_shards_];
+        std::lock_guard lock{shard.mutex_};
+
+        auto c = shard.map_.find(key_view_t{h, output});
+
+        return c == std::cend(shard.map_) ? 0 : c->second.count_;
+    }
+
+    index_t console_t::results_t::size() const noexcept { return size_; }
+
+    void console_t::results_t::clear()
+    {
+        for (shard_t &i : shards_)
+        {
+            std::lock_guard lock{i.mutex_};
+            i.dirty_.clear();
+            i.map_.clear();
+        }
+
+        size_ = 0;
+
+        return;
+    }
+
+    std::size_t console_t::results_t::hash(const std::vector<std::string> &output)
+    {
+        std::vector<std::size_t> ret;
+        ret.reserve(std::size(output));
+
+        for (const auto &i : output)
+            ret.emplace_back(std::hash<std::string>{}(i));
+
+        return std::hash<std::vector<std::size_t>>{}(ret);
+    }
+
+    void console_t::spill_t::push(const ptr_t &machine)
+    {
+        std::vector<index_t> data = machine->serialise();
+        index_t n = std::size(data);
+
+        std::lock_guard lock{mutex_};
+
+        if (not file_)
+        {
+            file_.reset(std::tmpfile());
+            if (not file_)
+                throw std::runtime_error{"In Machine::console_t::spill_t::push(const ptr_t &):\n"
+                    "Cannot open a temporary file.\n"};
+        }
+
+        if (not prototype_)
+            prototype_ = std::make_shared<machine_t>(*machine);
+
+        if (std::fseek(file_.get(), write_, SEEK_SET) != 0 or
+            std::fwrite(&n, sizeof(index_t), 1, file_.get()) != 1 or
+            std::fwrite(std::data(data), sizeof(index_t), n, file_.get()) != n)
+            throw std::runtime_error{"In Machine::console_t::spill_t::push(const ptr_t &):\n"
+                "Cannot write to the temporary file.\n"};
+
+        write_ = std::ftell(file_.get());
+        ++size_;
+
+        return;
+    }
+
+    index_t console_t::spill_t::pop(list_t &list, index_t n)
+    {
+        std::vector<std::vector<index_t>> data;
+        ptr_t prototype;
+
+        {
+            std::lock_guard lock{mutex_};
+
+            if (not file_ or std::fseek(file_.get(), read_, SEEK_SET) != 0)
+                return 0;
+
+            while (std::size(data) != n and size_ != 0)
+            {
+                index_t m;
+                std::vector<index_t> &d = data.emplace_back();
+
+                if (std::fread(&m, sizeof(index_t), 1, file_.get()) != 1 or
+                    (d.resize(m), std::fread(std::data(d), sizeof(index_t), m, file_.get()) != m))
+                    throw std::runtime_error{"In Machine::console_t::spill_t::pop(list_t &, "
+                        "index_t):\nCannot read from the temporary file.\n"};
+
+                --size_;
+            }
+
+            read_ = std::ftell(file_.get());
+            if (size_ == 0)
+                read_ = write_ = 0;
+
+            prototype = prototype_;
+        }
+
+        for (const auto &i : data)
+        {
+            ptr_t a = std::make_shared<machine_t>(*prototype);
+            a->deserialise(i);
+            list.emplace_back(std::move(a));
+        }
+
+        return std::size(data);
+    }
+
+    index_t console_t::spill_t::size() const noexcept { return size_; }
+
+    void console_t::spill_t::clear()
+    {
+        std::lock_guard lock{mutex_};
+
+        file_.reset();
+        prototype_.reset();
+        read_ = write_ = 0;
+        size_ = 0;
+
+        return;
+    }
+
+    console_t::pool_t::pool_t(index_t n)
+    {
+        for (index_t i = 0; i != n; ++i)
+            workers_.emplace_back(std::make_unique<worker_t>());
+
+        for (index_t i = 0; i != n; ++i)
+            threads_.emplace_back([this, i] { loop(i); });
+
+        return;
+    }
+
+    console_t::pool_t::~pool_t()
+    {
+        {
+            std::lock_guard lock{mutex_};
+            exit_ = true;
+        }
+
+        start_.notify_all();
+
+        for (auto &i : threads_)
+            i.join();
+
+        return;
+    }
+
+    index_t console_t::pool_t::size() const noexcept { return std::size(workers_); }
+
+    console_t::pool_t::worker_t &console_t::pool_t::worker(index_t i) { return *workers_[i]; }
+
+    void console_t::pool_t::run(std::function<void(index_t)> job)
+    {
+        std::unique_lock lock{mutex_};
+
+        job_ = std::move(job);
+        running_ = std::size(threads_);
+        ++generation_;
+
+        start_.notify_all();
+        done_.wait(lock, [this] { return running_ == 0; });
+
+        job_ = nullptr;
+
+        if (exception_)
+            std::rethrow_exception(std::exchange(exception_, nullptr));
+
+        return;
+    }
+
+    bool console_t::pool_t::pop(index_t w, list_t &local)
+    {
+        if (priority_)
+        {
+            std::lock_guard lock{queue_mutex_};
+
+            if (std::empty(queue_))
+                return false;
+
+            local.splice(std::cend(local), std::begin(queue_)->second);
+            queue_.erase(std::begin(queue_));
+
+            return true;
+        }
+
+        {
+            worker_t &own = *workers_[w];
+            std::lock_guard lock{own.mutex_};
+
+            if (not std::empty(own.deque_))
+            {
+                local.splice(std::cend(local), own.deque_, std::prev(std::end(own.deque_)));
+                return true;
+            }
+        }
+
+        for (index_t i = 1; i != std::size(workers_); ++i)
+        {
+            worker_t &victim = *workers_[(w + i) % std::size(workers_)];
+            std::lock_guard lock{victim.mutex_};
+
+            if (not std::empty(victim.deque_))
+            {
+                local.splice(std::cend(local), victim.deque_, std::begin(victim.deque_));
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void console_t::pool_t::push(index_t w, list_t &local)
+    {
+        if (priority_)
+        {
+            std::vector<index_t> p;
+            p.reserve(std::size(local));
+
+            for (const auto &i : local)
+                p.emplace_back(priority_(*i));
+
+            {
+                std::lock_guard lock{queue_mutex_};
+
+                for (index_t i : p)
+                {
+                    list_t &l = queue_.emplace(i, list_t{})->second;
+                    l.splice(std::cend(l), local, std::begin(local));
+                }
+            }
+
+            wake();
+
+            return;
+        }
+
+        {
+            worker_t &own = *workers_[w];
+            std::lock_guard lock{own.mutex_};
+
+            own.deque_.splice(std::cend(own.deque_), local);
+        }
+
+        wake();
+
+        return;
+    }
+
+    void console_t::pool_t::order(std::function<index_t(const machine_t &)> priority)
+    {
+        priority_ = std::move(priority);
+        return;
+    }
+
+    void console_t::pool_t::drain(list_t &list)
+    {
+        for (auto &i : workers_)
+            list.splice(std::cend(list), i->deque_);
+
+        for (auto &i : queue_)
+            list.splice(std::cend(list), i.second);
+
+        queue_.clear();
+
+        return;
+    }
+
+    index_t console_t::pool_t::signal() const noexcept { return signal_; }
+
+    void console_t::pool_t::park(index_t signal, const std::function<bool()> &ready)
+    {
+        std::unique_lock lock{idle_mutex_};
+
+        ++parked_;
+        idle_.wait(lock, [&] { return signal_ != signal or ready(); });
+        --parked_;
+
+        return;
+    }
+
+    void console_t::pool_t::notify()
+    {
+        {
+            std::lock_guard lock{idle_mutex_};
+            ++signal_;
+        }
+
+        idle_.notify_all();
+
+        return;
+    }
+
+    void console_t::pool_t::wake()
+    {
+        ++signal_;
+
+        // A worker that parks after reading parked_ here sees the new signal_
+        if (parked_ != 0)
+        {
+            std::lock_guard lock{idle_mutex_};
+            idle_.notify_one();
+        }
+
+        return;
+    }
+
+    void console_t::pool_t::loop(index_t i)
+    {
+        index_t generation = 0;
+
+        while (true)
+        {
+            std::unique_lock lock{mutex_};
+            start_.wait(lock, [this, generation] { return exit_ or generation_ != generation; });
+
+            if (exit_)
+                return;
+
+            generation = generation_;
+
+            std::exception_ptr exception;
+
+            lock.unlock();
+            try { job_(i); }
+            catch (...) { exception = std::current_exception(); }
+            lock.lock();
+
+            if (exception and not exception_)
+                exception_ = std::move(exception);
+
+            if (--running_ == 0)
+                done_.notify_all();
+        }
+    }
+
+    bool console_t::visited_t::insert(std::vector<index_t> arg, index_t depth)
+    {
+        std::size_t h = std::hash<std::vector<index_t>>{}(arg);
+        shard_t &shard = shards_[h % n_shards_];
+        std::lock_guard lock{shard.mutex_};
+
+        auto [it, inserted] = shard.map_.try_emplace(std::move(arg), depth);
+
+        if (inserted)
+            return true;
+
+        if (it->second <= depth)
+            return false;
+
+        it->second = depth;
+
+        return true;
+    }
+
+    void console_t::visited_t::clear()
+    {
+        for (shard_t &i : shards_)
+        {
+            std::lock_guard lock{i.mutex_};
+            i.map_.clear();
+        }
+
+        return;
+    }
+
+    index_t console_t::visited_t::size()
+    {
+        index_t ret = 0;
+
+        for (shard_t &i : shards_)
+        {
+            std::lock_guard lock{i.mutex_};
+            ret += std::size(i.map_);
+        }
+
+        return ret;
+    }
+
+    std::string console_t::load_program()
+    {
+        std::string ret;
+        std::lock_guard lock{mutex_};
+
+        {
+            bool error_in_loading = true;
+
+            try
+            {
+                std::ifstream stream{*program_name()};
+                ptr_t new_machine = std::make_shared<machine_t>(stream);
+
+                if (not new_machine or new_machine->state() != machine_t::machine_state_t::invalid)
+                    abort("console_t::load_program()");
+
+                error_in_loading = false;
+
+                clear();
+
+                invalid_machines_ = {std::move(new_machine)};
+                focus_ = std::begin(invalid_machines_);
+
+                state_ = static_cast<console_state_t>(console_state_t::program_loaded |
+                    (*focus_)->deterministic());
+            }
+
+            catch (std::runtime_error &e)
+            {
+                ret = e.what();
+                *tui().menu().strings()[0] = "Error loading the program.";
+
+                if (not error_in_loading)
+                {
+                    clear();
+                    tui().update_all();
+                }
+
+                return ret;
+            }
+
+            if (*focus_)
+                for (index_t i = 0; i != std::size((*focus_)->devices()); ++i)
+                {
+                    tui().devices().input_strings().emplace_back(std::make_shared<std::string>());
+                    strings_.emplace_back(std::make_shared<std::string>());
+                    tui().menu().strings().emplace_back(strings_.back());
+                }
+
+            *tui().menu().strings()[0] = "Program loaded.";
+            tui().menu().tab_selected() = 0;
+        }
+
+        tui().update_all();
+
+        return ret;
+    }
+
+    void console_t::initialise_all()
+    {
+        {
+            std::lock_guard lock{mutex_};
+
+            reset();
+
+            const std::string &s = *initialiser_string();
+
+            (*focus_)->initialise(s);
+
+            if ((**focus_).state() == machine_t::machine_state_t::running)
+            {
+                running_machines_.splice(std::cend(running_machines_), invalid_machines_);
+                running_machines_.splice(std::cend(running_machines_), blocked_machines_);
+
+                for (auto &i : halted_machines_)
+                    running_machines_.splice(std::cend(running_machines_), i.second);
+
+                if (std::size(running_machines_) != 1)
+                    abort("console_t::initialise_all()");
+
+                focus_ = std::begin(running_machines_);
+            }
+            else if ((**focus_).state() == machine_t::machine_state_t::blocked)
+            {
+                blocked_machines_.splice(std::cend(blocked_machines_), invalid_machines_);
+                blocked_machines_.splice(std::cend(blocked_machines_), running_machines_);
+
+                for (auto &i : halted_machines_)
+                    blocked_machines_.splice(std::cend(running_machines_), i.second);
+
+                if (std::size(blocked_machines_) != 1)
+                    abort("console_t::initialise_all()");
+
+                focus_ = std::begin(blocked_machines_);
+            }
+            else
+                abort("console_t::initialise_all()");
+
+            halted_machines_.clear();
+            results_.clear();
+
+            for (index_t i = 0; i != std::size((*focus_)->devices()); ++i)
+                *(tui().devices().input_strings()[i]) = s;
+
+            state_ = static_cast<console_state_t>((*focus_)->deterministic() |
+                    console_state_t::program_loaded | console_state_t::running);
+        }
+
+        tui().applicable_instructions().update();
+
+        return;
+    }
+
+    void console_t::initialise_individually()
+    {
+        {
+            std::lock_guard lock{mutex_};
+
+            reset();
+
+            std::vector<std::string> input;
+            for (index_t i = 0; i != std::size((*focus_)->devices()); ++i)
+            {
+                const std::string &s = *initialiser_string_vector(i);
+                input.emplace_back(s);
+                *(tui().devices().input_strings()[i]) = s;
             }
 
             (*focus_)->initialise(
@@ -2250,6 +3148,9 @@ namespace Machine
             else
                 abort("console_t::initialise_individually()");
 
+            halted_machines_.clear();
+            results_.clear();
+
             state_ = static_cast<console_state_t>((*focus_)->deterministic() |
                     console_state_t::program_loaded | console_state_t::running);
         }
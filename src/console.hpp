@@ -1,11 +1,21 @@
 #pragma once
 #include "machine.hpp"
+#include "hash.hpp"
 
+#include <array>
+#include <atomic>
 #include <list>
 #include <thread>
 #include <mutex>
 #include <future>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <cstdio>
 
 #include "ftxui/component/captured_mouse.hpp"
 #include "ftxui/component/component.hpp"
@@ -26,6 +36,17 @@ namespace Machine
             running = 4
         };
 
+        enum class strategy_t { breadth_first, depth_first, iterative_deepening, best_first };
+
+        enum class overflow_t { spill, prune };
+
+        struct batch_result_t
+        {
+            machine_t::machine_state_t state_; // invalid: the input could not be read
+                                                // running: unfinished (paused or depth bound)
+            std::vector<std::vector<std::string>> output_;
+        };
+
     private:
         class tui_t
         {
@@ -260,10 +281,197 @@ namespace Machine
             static ftxui::ScreenInteractive &screen();
         };
 
+        class visited_t
+        {
+        private:
+            static constexpr index_t n_shards_ = 64;
+
+            struct shard_t
+            {
+                std::mutex mutex_{};
+                std::unordered_map<std::vector<index_t>, index_t> map_{};
+            };
+
+            std::array<shard_t, n_shards_> shards_{};
+
+        public:
+            visited_t() = default;
+            ~visited_t() = default;
+
+            visited_t(const visited_t &) = delete;
+            visited_t &operator=(const visited_t &) = delete;
+
+            visited_t(visited_t &&) noexcept = delete;
+            visited_t &operator=(visited_t &&) noexcept = delete;
+
+        public:
+            bool insert(std::vector<index_t>, index_t);
+            void clear();
+            index_t size();
+        };
+
         using ptr_t = std::shared_ptr<machine_t>;
         using list_t = std::list<ptr_t>;
         using it_t = list_t::iterator;
 
+        class results_t
+        {
+        private:
+            static constexpr index_t n_shards_ = 64;
+
+            struct key_t
+            {
+                std::size_t hash_;
+                std::vector<std::string> output_;
+            };
+
+            struct key_view_t
+            {
+                std::size_t hash_;
+                const std::vector<std::string> &output_;
+            };
+
+            struct key_hash_t
+            {
+                using is_transparent = void;
+
+                std::size_t operator()(const key_t &arg) const noexcept { return arg.hash_; }
+                std::size_t operator()(const key_view_t &arg) const noexcept { return arg.hash_; }
+            };
+
+            struct key_equal_t
+            {
+                using is_transparent = void;
+
+                template<class a_t, class b_t>
+                bool operator()(const a_t &a, const b_t &b) const
+                    { return a.hash_ == b.hash_ and a.output_ == b.output_; }
+            };
+
+            struct class_t
+            {
+                index_t count_{0};
+                list_t new_{};
+            };
+
+            struct shard_t
+            {
+                std::mutex mutex_{};
+                std::unordered_map<key_t, class_t, key_hash_t, key_equal_t> map_{};
+                std::vector<std::pair<const key_t *, class_t *>> dirty_{};
+            };
+
+            std::array<shard_t, n_shards_> shards_{};
+            std::atomic<index_t> size_{0};
+
+        public:
+            results_t() = default;
+            ~results_t() = default;
+
+            results_t(const results_t &) = delete;
+            results_t &operator=(const results_t &) = delete;
+
+            results_t(results_t &&) noexcept = delete;
+            results_t &operator=(results_t &&) noexcept = delete;
+
+        public:
+            void insert(list_t &, it_t, bool);
+            void drain(std::map<std::vector<std::string>, list_t> &);
+            index_t count(const std::vector<std::string> &);
+            index_t size() const noexcept;
+            void clear();
+
+        private:
+            static std::size_t hash(const std::vector<std::string> &);
+        };
+
+        class spill_t
+        {
+        private:
+            std::mutex mutex_{};
+            std::unique_ptr<std::FILE, int (*)(std::FILE *)> file_{nullptr, std::fclose};
+            ptr_t prototype_{};
+            long read_{0};
+            long write_{0};
+            std::atomic<index_t> size_{0};
+
+        public:
+            spill_t() = default;
+            ~spill_t() = default;
+
+            spill_t(const spill_t &) = delete;
+            spill_t &operator=(const spill_t &) = delete;
+
+            spill_t(spill_t &&) noexcept = delete;
+            spill_t &operator=(spill_t &&) noexcept = delete;
+
+        public:
+            void push(const ptr_t &);
+            index_t pop(list_t &, index_t);
+            index_t size() const noexcept;
+            void clear();
+        };
+
+        class pool_t
+        {
+        public:
+            struct worker_t
+            {
+                std::mutex mutex_{};
+                list_t deque_{};
+                list_t next_{};
+                list_t halted_{};
+                list_t blocked_{};
+            };
+
+        private:
+            std::vector<std::unique_ptr<worker_t>> workers_;
+            std::vector<std::thread> threads_;
+            std::mutex mutex_{};
+            std::condition_variable start_{};
+            std::condition_variable done_{};
+            std::function<void(index_t)> job_{};
+            std::exception_ptr exception_{};
+            index_t generation_{0};
+            index_t running_{0};
+            bool exit_{false};
+            std::function<index_t(const machine_t &)> priority_{};
+            std::mutex queue_mutex_{};
+            std::multimap<index_t, list_t> queue_{};
+            std::mutex idle_mutex_{};
+            std::condition_variable idle_{};
+            std::atomic<index_t> signal_{0};
+            std::atomic<index_t> parked_{0};
+
+        public:
+            pool_t() = delete;
+            ~pool_t();
+
+            pool_t(const pool_t &) = delete;
+            pool_t &operator=(const pool_t &) = delete;
+
+            pool_t(pool_t &&) noexcept = delete;
+            pool_t &operator=(pool_t &&) noexcept = delete;
+
+            pool_t(index_t);
+
+        public:
+            index_t size() const noexcept;
+            worker_t &worker(index_t);
+            void run(std::function<void(index_t)>);
+            bool pop(index_t, list_t &);
+            void push(index_t, list_t &);
+            void order(std::function<index_t(const machine_t &)>);
+            void drain(list_t &);
+            index_t signal() const noexcept;
+            void park(index_t, const std::function<bool()> &);
+            void notify();
+
+        private:
+            void loop(index_t);
+            void wake();
+        };
+
     private:
         static inline list_t null_list_{nullptr};
         static inline std::atomic<bool> console_constructed_{false};
@@ -280,6 +488,30 @@ namespace Machine
         std::atomic<bool> pause_halt_ = true;
         std::atomic<console_state_t> state_{console_state_t::empty};
         std::atomic<index_t> instruction_counter_{0};
+        std::atomic<index_t> quantum_{64};
+        std::atomic<index_t> pending_{0};
+        std::atomic<bool> deduplicate_ = false;
+        std::atomic<index_t> pruned_counter_{0};
+        visited_t visited_{};
+        results_t results_{};
+        std::atomic<bool> retain_halted_ = false;
+        std::function<bool(const machine_t &)> search_predicate_{};
+        index_t search_classes_{0};
+        std::atomic<strategy_t> strategy_{strategy_t::breadth_first};
+        std::function<index_t(const machine_t &)> priority_{};
+        std::atomic<index_t> depth_bound_{negative_1};
+        std::atomic<index_t> bound_{negative_1};
+        std::atomic<index_t> recorded_depth_{0};
+        std::atomic<index_t> frontier_cap_{negative_1};
+        std::atomic<index_t> memory_budget_{negative_1};
+        std::atomic<index_t> capacity_{negative_1};
+        std::atomic<overflow_t> overflow_{overflow_t::spill};
+        std::atomic<index_t> spilled_counter_{0};
+        std::atomic<index_t> dropped_counter_{0};
+        spill_t spill_{};
+        std::vector<batch_result_t> batch_{};
+        static constexpr index_t batch_frontier_cap_ = index_t{1} << 16; // Per input, if unset
+        pool_t pool_{n_threads_};
         std::vector<std::shared_ptr<std::string>> strings_{std::make_shared<std::string>(),
             std::make_shared<std::string>()};
         tui_t tui_{*this};
@@ -308,6 +540,7 @@ namespace Machine
         console_t &run();
         console_t &step_all();
         console_t &run_all();
+        console_t &run_batch(std::vector<std::string>);
         console_t &pause();
         console_t &launch_tui();
         console_t &close_tui();
@@ -315,6 +548,7 @@ namespace Machine
         bool find_output(const std::vector<std::string> &) const;
         void wait();
         std::vector<std::vector<std::string>> output() const;
+        const std::vector<batch_result_t> &batch_output() const;
 
         template<class Rep, class Period>
         bool wait_for(const std::chrono::duration<Rep, Period> &time)
@@ -325,13 +559,44 @@ namespace Machine
         }
 
         std::atomic<bool> &pause_halt();
+        std::atomic<bool> &deduplicate();
+        std::atomic<index_t> &quantum();
+        std::atomic<bool> &retain_halted();
+        index_t output_count(const std::vector<std::string> &);
+        std::vector<std::string> print_fusions();
+        console_t &search_output(std::string);
+        console_t &search_output(std::vector<std::string>);
+        console_t &search_predicate(std::function<bool(const machine_t &)>);
+        console_t &search_classes(index_t);
+        console_t &search_all();
+        console_t &strategy(strategy_t);
+        console_t &priority(std::function<index_t(const machine_t &)>);
+        std::atomic<index_t> &depth_bound();
+        std::atomic<index_t> &frontier_cap();
+        std::atomic<index_t> &memory_budget();
+        console_t &overflow(overflow_t);
+        index_t spilled_counter() const;
+        index_t dropped_counter() const;
+        index_t pruned_counter() const;
 
     private:
+        void settle() noexcept; // Like wait(), but the error of the job is only shown in the menu
+        std::future<void> launch(std::function<void()>); // Runs a job, showing its error in the menu
         void clear() noexcept; // The caller must have locked mutex_
         void reset(); // Idem
-        void step(list_t &, it_t, list_t &, list_t &); // The caller must have locked mutex_ and
-                                                       // each list must be modifiable without race
-                                                       // conditions
+        bool step(list_t &, it_t, list_t &, list_t &, index_t = 1); // The caller must have
+                                                                     // locked mutex_ and each list
+                                                                     // must be modifiable without
+                                                                     // race conditions
+        void work(index_t, index_t, bool); // Idem
+        void explore(); // Idem
+        void deepen(); // Idem
+        void distribute(); // Idem
+        void collect(); // Idem
+        void store(list_t &); // Idem
+        void overflow(list_t &); // Idem
+        void balance(); // Idem
+        batch_result_t evaluate(const machine_t &, const std::string &); // Idem
         std::string load_program();
         void initialise_all();
         void initialise_individually();
@@ -66,10 +66,10 @@ namespace Machine
     }
 
     control_t::control_t(const control_t &arg) :
-        device_t{std::unique_ptr<encoder_t>(arg.encoder_->clone())},
+        device_t{arg.encoder_},
         state_{arg.state_},
-        initialiser_{std::unique_ptr<control_initialiser_t>{arg.initialiser_->clone()}},
-        terminator_{std::unique_ptr<control_terminator_t>{arg.terminator_->clone()}} {}
+        initialiser_{arg.initialiser_},
+        terminator_{arg.terminator_} {}
 
     control_t &control_t::operator=(const control_t &arg) { return *this = control_t{arg}; }
 
@@ -83,6 +83,16 @@ namespace Machine
 
     std::string control_t::print_state() const { return std::to_string(state_); }
 
+    index_t control_t::observation() const { return state_; }
+
+    void control_t::observe(index_t arg) { state_ = arg; return; }
+
+    void control_t::configuration(std::vector<index_t> &arg) const
+        { arg.emplace_back(state_); return; }
+
+    void control_t::restore_configuration(std::span<const index_t> &arg)
+        { state_ = arg[0]; arg = arg.subspan(1); return; }
+
     index_t &control_t::state() noexcept { return state_; }
 
     const index_t &control_t::state() const noexcept { return state_; }
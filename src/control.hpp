@@ -44,8 +44,8 @@ namespace Machine
     {
     private:
         index_t state_{negative_1};
-        std::unique_ptr<control_initialiser_t> initialiser_;
-        std::unique_ptr<control_terminator_t> terminator_;
+        std::shared_ptr<const control_initialiser_t> initialiser_;
+        std::shared_ptr<const control_terminator_t> terminator_;
 
     public:
         control_t() = delete;
@@ -66,6 +66,10 @@ namespace Machine
         const control_terminator_t &terminator() const override;
         std::string print_name() const override;
         std::string print_state() const override;
+        index_t observation() const override;
+        void observe(index_t) override;
+        void configuration(std::vector<index_t> &) const override;
+        void restore_configuration(std::span<const index_t> &) override;
 
         index_t &state() noexcept;
         const index_t &state() const noexcept;
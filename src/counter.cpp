@@ -40,9 +40,9 @@ namespace Machine
     }
 
     counter_t::counter_t(const counter_t &arg) :
-        device_t{std::unique_ptr<encoder_t>{arg.encoder().clone()}},
-        initialiser_{arg.initialiser_->clone()},
-        terminator_{arg.terminator_->clone()},
+        device_t{arg.encoder_},
+        initialiser_{arg.initialiser_},
+        terminator_{arg.terminator_},
         state_{arg.state_} {}
 
     counter_t &counter_t::operator=(const counter_t &arg) { return *this = counter_t{arg}; }
@@ -68,6 +68,38 @@ namespace Machine
 
     std::string counter_t::print_state() const { return state_.print(encoder()); }
 
+    index_t counter_t::n_observations() const { return 3; }
+
+    index_t counter_t::observation() const { return state_.zero() ? 0 : state_.pos() ? 1 : 2; }
+
+    void counter_t::observe(index_t arg)
+    {
+        static constexpr std::array<integer_t, 3> witness{0, 1, -1};
+        state_ = witness[arg];
+        return;
+    }
+
+    void counter_t::configuration(std::vector<index_t> &arg) const
+    {
+        arg.emplace_back(state_.neg() ? 1 : 0);
+        return append_configuration(arg, state_.abs());
+    }
+
+    void counter_t::restore_configuration(std::span<const index_t> &arg)
+    {
+        const bool neg = arg[0] != 0;
+        unsigned_number_t magnitude;
+
+        arg = arg.subspan(1);
+        extract_configuration(arg, magnitude);
+
+        state_ = std::move(magnitude);
+        if (neg)
+            state_ = -state_;
+
+        return;
+    }
+
     signed_number_t &counter_t::state() { return state_; }
 
     const signed_number_t &counter_t::state() const { return state_; }
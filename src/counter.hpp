@@ -73,8 +73,8 @@ namespace Machine
     class counter_t final : public device_t
     {
     private:
-        std::unique_ptr<counter_initialiser_t> initialiser_;
-        std::unique_ptr<counter_terminator_t> terminator_;
+        std::shared_ptr<const counter_initialiser_t> initialiser_;
+        std::shared_ptr<const counter_terminator_t> terminator_;
         signed_number_t state_{};
 
     public:
@@ -98,6 +98,11 @@ namespace Machine
         const counter_terminator_t &terminator() const override;
         std::string print_name() const override;
         std::string print_state() const override;
+        index_t n_observations() const override;
+        index_t observation() const override;
+        void observe(index_t) override;
+        void configuration(std::vector<index_t> &) const override;
+        void restore_configuration(std::span<const index_t> &) override;
 
         signed_number_t &state();
         const signed_number_t &state() const;
@@ -0,0 +1,284 @@
+#pragma once
+#include "fwd.hpp"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Machine
+{
+    namespace Apparatus
+    {
+        template<class value_t>
+        class cow_t;
+
+        template<class value_t, index_t chunk_size = 256>
+        class cow_vector_t;
+
+        template<class value_t>
+        value_t &detach(std::shared_ptr<value_t> &);
+
+        template<class value_t>
+        class cow_t
+        {
+        private:
+            std::shared_ptr<value_t> ptr_;
+
+        public:
+            cow_t();
+            ~cow_t() = default;
+
+            cow_t(const cow_t &) noexcept = default;
+            cow_t &operator=(const cow_t &) noexcept = default;
+
+            cow_t(cow_t &&) noexcept = default;
+            cow_t &operator=(cow_t &&) noexcept = default;
+
+            cow_t(value_t);
+
+        public:
+            const value_t &operator*() const noexcept;
+            const value_t *operator->() const noexcept;
+            value_t &mutate();
+
+            void swap(cow_t &) noexcept;
+        };
+
+        template<class value_t, index_t chunk_size>
+        class cow_vector_t
+        {
+            static_assert(chunk_size != 0);
+
+        private:
+            static constexpr index_t table_size = 64;
+            static constexpr index_t table_span = chunk_size * table_size;
+
+            using chunk_t = std::array<value_t, chunk_size>;
+            using table_t = std::array<std::shared_ptr<chunk_t>, table_size>;
+            using spine_t = std::vector<std::shared_ptr<table_t>>;
+
+        private:
+            std::shared_ptr<spine_t> spine_{};
+            index_t begin_{0};
+            index_t size_{0};
+
+        public:
+            cow_vector_t() noexcept = default;
+            ~cow_vector_t() = default;
+
+            cow_vector_t(const cow_vector_t &) noexcept = default;
+            cow_vector_t &operator=(const cow_vector_t &) noexcept = default;
+
+            cow_vector_t(cow_vector_t &&) noexcept = default;
+            cow_vector_t &operator=(cow_vector_t &&) noexcept = default;
+
+        public:
+            bool empty() const noexcept;
+            index_t size() const noexcept;
+
+            const value_t &operator[](index_t) const noexcept;
+            const value_t &front() const noexcept;
+            const value_t &back() const noexcept;
+            value_t &mutate(index_t);
+
+            void push_back(const value_t &);
+            void pop_back();
+            void pop_front();
+            void resize(index_t, const value_t & = value_t{});
+            void clear() noexcept;
+
+            bool operator==(const cow_vector_t &) const;
+            bool operator!=(const cow_vector_t &) const;
+
+            void swap(cow_vector_t &) noexcept;
+
+        private:
+            spine_t &mutate_spine();
+            std::shared_ptr<chunk_t> &mutate_chunk(index_t);
+        };
+
+        template<class value_t>
+        value_t &detach(std::shared_ptr<value_t> &ptr)
+        {
+            if (ptr.use_count() != 1)
+                ptr = std::make_shared<value_t>(std::as_const(*ptr));
+            else
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+            return *ptr;
+        }
+
+        template<class value_t>
+        cow_t<value_t>::cow_t() : ptr_{std::make_shared<value_t>()} {}
+
+        template<class value_t>
+        cow_t<value_t>::cow_t(value_t arg) : ptr_{std::make_shared<value_t>(std::move(arg))} {}
+
+        template<class value_t>
+        const value_t &cow_t<value_t>::operator*() const noexcept { return *ptr_; }
+
+        template<class value_t>
+        const value_t *cow_t<value_t>::operator->() const noexcept { return ptr_.get(); }
+
+        template<class value_t>
+        value_t &cow_t<value_t>::mutate() { return detach(ptr_); }
+
+        template<class value_t>
+        void cow_t<value_t>::swap(cow_t &arg) noexcept { ptr_.swap(arg.ptr_); }
+
+        template<class value_t, index_t chunk_size>
+        bool cow_vector_t<value_t, chunk_size>::empty() const noexcept { return size_ == 0; }
+
+        template<class value_t, index_t chunk_size>
+        index_t cow_vector_t<value_t, chunk_size>::size() const noexcept { return size_; }
+
+        template<class value_t, index_t chunk_size>
+        const value_t &cow_vector_t<value_t, chunk_size>::operator[](index_t arg) const noexcept
+        {
+            arg += begin_;
+            return (*(*(*spine_)[arg / table_span])[arg / chunk_size % table_size])
+                [arg % chunk_size];
+        }
+
+        template<class value_t, index_t chunk_size>
+        const value_t &cow_vector_t<value_t, chunk_size>::front() const noexcept
+            { return (*this)[0]; }
+
+        template<class value_t, index_t chunk_size>
+        const value_t &cow_vector_t<value_t, chunk_size>::back() const noexcept
+            { return (*this)[size_ - 1]; }
+
+        template<class value_t, index_t chunk_size>
+        value_t &cow_vector_t<value_t, chunk_size>::mutate(index_t arg)
+        {
+            arg += begin_;
+            return detach(mutate_chunk(arg))[arg % chunk_size];
+        }
+
+        template<class value_t, index_t chunk_size>
+        void cow_vector_t<value_t, chunk_size>::push_back(const value_t &arg)
+        {
+            const index_t p = begin_ + size_;
+            std::shared_ptr<chunk_t> &chunk = mutate_chunk(p);
+
+            if (not chunk)
+                chunk = std::make_shared<chunk_t>();
+
+            detach(chunk)[p % chunk_size] = arg;
+            ++size_;
+
+            return;
+        }
+
+        template<class value_t, index_t chunk_size>
+        void cow_vector_t<value_t, chunk_size>::pop_back()
+        {
+            if (--size_ == 0)
+                return clear();
+
+            const index_t p = begin_ + size_;
+
+            if (p % table_span == 0)
+                mutate_spine().pop_back();
+            else if (p % chunk_size == 0)
+                mutate_chunk(p).reset();
+
+            return;
+        }
+
+        template<class value_t, index_t chunk_size>
+        void cow_vector_t<value_t, chunk_size>::pop_front()
+        {
+            if (--size_ == 0)
+                return clear();
+
+            if (++begin_ == table_span)
+            {
+                spine_t &spine = mutate_spine();
+                spine.erase(std::begin(spine));
+                begin_ = 0;
+            }
+            else if (begin_ % chunk_size == 0)
+                mutate_chunk(begin_ - 1).reset();
+
+            return;
+        }
+
+        template<class value_t, index_t chunk_size>
+        void cow_vector_t<value_t, chunk_size>::resize(index_t arg, const value_t &value)
+        {
+            while (size_ > arg)
+                pop_back();
+
+            while (size_ < arg)
+                push_back(value);
+
+            return;
+        }
+
+        template<class value_t, index_t chunk_size>
+        void cow_vector_t<value_t, chunk_size>::clear() noexcept
+        {
+            spine_.reset();
+            begin_ = 0;
+            size_ = 0;
+
+            return;
+        }
+
+        template<class value_t, index_t chunk_size>
+        bool cow_vector_t<value_t, chunk_size>::operator==(const cow_vector_t &arg) const
+        {
+            if (size_ != arg.size_)
+                return false;
+
+            if (spine_ == arg.spine_ and begin_ == arg.begin_)
+                return true;
+
+            for (index_t i = 0; i != size_; ++i)
+                if ((*this)[i] != arg[i])
+                    return false;
+
+            return true;
+        }
+
+        template<class value_t, index_t chunk_size>
+        bool cow_vector_t<value_t, chunk_size>::operator!=(const cow_vector_t &arg) const
+            { return not (*this == arg); }
+
+        template<class value_t, index_t chunk_size>
+        void cow_vector_t<value_t, chunk_size>::swap(cow_vector_t &arg) noexcept
+        {
+            using std::swap;
+
+            swap(spine_, arg.spine_);
+            swap(begin_, arg.begin_);
+            swap(size_, arg.size_);
+
+            return;
+        }
+
+        template<class value_t, index_t chunk_size>
+        auto cow_vector_t<value_t, chunk_size>::mutate_spine() -> spine_t &
+        {
+            if (not spine_)
+                spine_ = std::make_shared<spine_t>();
+
+            return detach(spine_);
+        }
+
+        template<class value_t, index_t chunk_size>
+        auto cow_vector_t<value_t, chunk_size>::mutate_chunk(index_t arg)
+            -> std::shared_ptr<chunk_t> &
+        {
+            spine_t &spine = mutate_spine();
+
+            if (arg / table_span == std::size(spine))
+                spine.emplace_back(std::make_shared<table_t>());
+
+            return detach(spine[arg / table_span])[arg / chunk_size % table_size];
+        }
+    }
+}
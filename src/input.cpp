@@ -6,12 +6,12 @@ namespace Machine
     input_initialiser_t *input_initialiser_t::clone() const { return new input_initialiser_t{}; }
 
     void input_initialiser_t::initialise(device_t &device, const std::string &string) const
-        { dynamic_cast<input_t &>(device).string() = device.encoder()(string); }
+        { dynamic_cast<input_t &>(device).assign(device.encoder()(string)); }
 
     input_terminator_t *input_terminator_t::clone() const { return new input_terminator_t{}; }
 
     bool input_terminator_t::terminating(const device_t &device) const
-        { return dynamic_cast<const input_t &>(device).string().empty(); }
+        { return dynamic_cast<const input_t &>(device).empty(); }
 
     std::string input_terminator_t::terminate(const device_t &device) const
     {
@@ -31,7 +31,7 @@ namespace Machine
     }
 
     input_t::input_t(const input_t &arg) :
-        device_t{std::unique_ptr<encoder_t>{arg.encoder_->clone()}}, string_{arg.string_} {}
+        device_t{arg.encoder_}, string_{arg.string_}, size_{arg.size_} {}
 
     input_t &input_t::operator=(const input_t &arg) { return *this = input_t{arg}; }
 
@@ -43,10 +43,84 @@ namespace Machine
 
     std::string input_t::print_name() const { return "Input"; }
 
-    std::string input_t::print_state() const { return string_.print_state_reverse(encoder()); }
+    std::string input_t::print_state() const
+    {
+        std::string ret{};
+
+        for (index_t i = size_; i != 0; --i)
+            ret.push_back(encoder()((*string_)[i - 1]));
+
+        return ret;
+    }
+
+    index_t input_t::n_observations() const
+        { return index_t{encoder().alphabet().max_character()} + 2; }
+
+    index_t input_t::observation() const { return size_ == 0 ? 0 : (*string_)[size_ - 1] + 1; }
+
+    void input_t::observe(index_t arg)
+    {
+        string_t string{encoder().alphabet()};
+        if (arg != 0)
+            string.push(arg - 1);
+
+        return assign(std::move(string));
+    }
+
+    void input_t::configuration(std::vector<index_t> &arg) const
+    {
+        arg.emplace_back(size_);
+        arg.emplace_back(size_ - 1);
+
+        for (index_t i = 0; i != size_; ++i)
+            arg.emplace_back((*string_)[i]);
+
+        return;
+    }
+
+    void input_t::restore_configuration(std::span<const index_t> &arg)
+    {
+        const index_t n = arg[0];
+        index_t i = 0;
 
-    string_t &input_t::string() { return string_; }
-    const string_t &input_t::string() const { return string_; }
+        if (n <= std::size(*string_))
+            while (i != n and (*string_)[i] == arg[2 + i])
+                ++i;
+
+        if (i == n)
+        {
+            size_ = n;
+            arg = arg.subspan(2 + n);
+
+            return;
+        }
+
+        string_t string{encoder().alphabet()};
+        extract_configuration(arg, string);
+
+        return assign(std::move(string));
+    }
+
+    void input_t::assign(string_t arg)
+    {
+        size_ = std::size(arg);
+        string_ = std::make_shared<const string_t>(std::move(arg));
+
+        return;
+    }
+
+    bool input_t::empty() const noexcept { return size_ == 0; }
+
+    bool input_t::see(character_t arg) const { return size_ != 0 and (*string_)[size_ - 1] == arg; }
+
+    index_t input_t::run(character_t arg) const noexcept
+        { return string_->run_backward(arg, size_); }
+
+    void input_t::pop(index_t arg) noexcept
+    {
+        size_ -= arg;
+        return;
+    }
 
     bool input_operation_t::correct_device(const device_t &device) const
         { return typeid(device) == typeid(input_t); }
@@ -58,14 +132,14 @@ namespace Machine
         { return new input_operation_scan_t{*this}; }
 
     bool input_operation_scan_t::applicable(const device_t &device) const
-        { return dynamic_cast<const input_t &>(device).string().see(character_); }
+        { return dynamic_cast<const input_t &>(device).see(character_); }
 
     void input_operation_scan_t::apply(device_t &device) const
     {
         if (not applicable(device))
             throw invalid_operation_t(*this, device);
 
-        dynamic_cast<input_t &>(device).string().pop();
+        dynamic_cast<input_t &>(device).pop();
         return;
     }
 
@@ -96,7 +170,7 @@ namespace Machine
         { return new input_operation_next_t{*this}; }
 
     bool input_operation_next_t::applicable(const device_t &device) const
-        { return dynamic_cast<const input_t &>(device).string().see(character_); }
+        { return dynamic_cast<const input_t &>(device).see(character_); }
 
     void input_operation_next_t::apply(device_t &device) const
     {
@@ -131,7 +205,7 @@ namespace Machine
         { return new input_operation_eof_t{*this}; }
 
     bool input_operation_eof_t::applicable(const device_t &device) const
-        { return dynamic_cast<const input_t &>(device).string().empty(); }
+        { return dynamic_cast<const input_t &>(device).empty(); }
 
     void input_operation_eof_t::apply(device_t &device) const
     {
@@ -36,7 +36,8 @@ namespace Machine
         static input_initialiser_t initialiser_;
         static input_terminator_t terminator_;
 
-        string_t string_{encoder().alphabet()};
+        std::shared_ptr<const string_t> string_{std::make_shared<const string_t>()};
+        index_t size_{0};
 
     public:
         input_t() = delete;
@@ -56,9 +57,17 @@ namespace Machine
         const input_terminator_t &terminator() const override;
         std::string print_name() const override;
         std::string print_state() const override;
-
-        string_t &string(); 
-        const string_t &string() const; 
+        index_t n_observations() const override;
+        index_t observation() const override;
+        void observe(index_t) override;
+        void configuration(std::vector<index_t> &) const override;
+        void restore_configuration(std::span<const index_t> &) override;
+
+        void assign(string_t);
+        bool empty() const noexcept;
+        bool see(character_t) const;
+        index_t run(character_t) const noexcept;
+        void pop(index_t = 1) noexcept;
     };
 
     class input_operation_t : public operation_t
@@ -2679,81 +2679,1149 @@ namespace Machine
         return;
     }
 
+    code_t::code_t(const operation_t &operation) : arguments_{0, 0, 0}
+    {
+        using enum opcode_t;
+
+        const std::type_info &type = typeid(operation);
+
+        if (type == typeid(noop_operation_t))
+            opcode_ = noop;
+
+        else if (type == typeid(control_operation_t))
+        {
+            const control_operation_t &op = dynamic_cast<const control_operation_t &>(operation);
+            opcode_ = control;
+            arguments_ = {op.from(), op.to(), 0};
+        }
+
+        else if (type == typeid(input_operation_scan_t))
+        {
+            opcode_ = input_scan;
+            arguments_[0] = dynamic_cast<const input_operation_scan_t &>(operation).character();
+        }
+
+        else if (type == typeid(input_operation_next_t))
+        {
+            opcode_ = input_next;
+            arguments_[0] = dynamic_cast<const input_operation_next_t &>(operation).character();
+        }
+
+        else if (type == typeid(input_operation_eof_t))
+            opcode_ = input_eof;
+
+        else if (type == typeid(output_operation_write_t))
+        {
+            opcode_ = output_write;
+            arguments_[0] = dynamic_cast<const output_operation_write_t &>(operation).character();
+        }
+
+        else if (type == typeid(stack_operation_push_t))
+        {
+            opcode_ = stack_push;
+            arguments_[0] = dynamic_cast<const stack_operation_push_t &>(operation).character();
+        }
+
+        else if (type == typeid(stack_operation_pop_t))
+        {
+            opcode_ = stack_pop;
+            arguments_[0] = dynamic_cast<const stack_operation_pop_t &>(operation).character();
+        }
+
+        else if (type == typeid(stack_operation_top_t))
+        {
+            opcode_ = stack_top;
+            arguments_[0] = dynamic_cast<const stack_operation_top_t &>(operation).character();
+        }
+
+        else if (type == typeid(stack_operation_empty_t))
+            opcode_ = stack_empty;
+
+        else if (type == typeid(queue_operation_enqueue_t))
+        {
+            opcode_ = queue_enqueue;
+            arguments_[0] = dynamic_cast<const queue_operation_enqueue_t &>(operation).character();
+        }
+
+        else if (type == typeid(queue_operation_dequeue_t))
+        {
+            opcode_ = queue_dequeue;
+            arguments_[0] = dynamic_cast<const queue_operation_dequeue_t &>(operation).character();
+        }
+
+        else if (type == typeid(queue_operation_empty_t))
+            opcode_ = queue_empty;
+
+        else if (type == typeid(unsigned_counter_operation_inc_t))
+            opcode_ = unsigned_counter_inc;
+
+        else if (type == typeid(unsigned_counter_operation_dec_t))
+            opcode_ = unsigned_counter_dec;
+
+        else if (type == typeid(unsigned_counter_operation_zero_t))
+            opcode_ = unsigned_counter_zero;
+
+        else if (type == typeid(unsigned_counter_operation_non_zero_t))
+            opcode_ = unsigned_counter_non_zero;
+
+        else if (type == typeid(counter_operation_inc_t))
+            opcode_ = counter_inc;
+
+        else if (type == typeid(counter_operation_dec_t))
+            opcode_ = counter_dec;
+
+        else if (type == typeid(counter_operation_zero_t))
+            opcode_ = counter_zero;
+
+        else if (type == typeid(counter_operation_pos_t))
+            opcode_ = counter_pos;
+
+        else if (type == typeid(counter_operation_neg_t))
+            opcode_ = counter_neg;
+
+        else if (type == typeid(tape_operation_see_t))
+        {
+            opcode_ = tape_see;
+            arguments_[0] = dynamic_cast<const tape_operation_see_t &>(operation).character();
+        }
+
+        else if (type == typeid(tape_operation_print_t))
+        {
+            opcode_ = tape_print;
+            arguments_[0] = dynamic_cast<const tape_operation_print_t &>(operation).character();
+        }
+
+        else if (type == typeid(tape_operation_move_l_t))
+            opcode_ = tape_move_l;
+
+        else if (type == typeid(tape_operation_move_r_t))
+            opcode_ = tape_move_r;
+
+        else if (type == typeid(tape_operation_athome_t))
+            opcode_ = tape_athome;
+
+        else if (type == typeid(tape_operation_compound_t))
+        {
+            const std::array<std::shared_ptr<operation_t>, 4> operations =
+                dynamic_cast<const tape_operation_compound_t &>(operation).operations();
+
+            opcode_ = tape_compound;
+
+            if (operations[0])
+                arguments_[0] |= compound_athome;
+
+            if (operations[1])
+            {
+                arguments_[0] |= compound_see;
+                arguments_[1] =
+                    dynamic_cast<const tape_operation_see_t &>(*operations[1]).character();
+            }
+
+            if (operations[2])
+            {
+                arguments_[0] |= compound_print;
+                arguments_[2] =
+                    dynamic_cast<const tape_operation_print_t &>(*operations[2]).character();
+            }
+
+            if (operations[3])
+                arguments_[0] |= typeid(*operations[3]) == typeid(tape_operation_move_l_t) ?
+                    compound_move_l : compound_move_r;
+        }
+
+        else if (type == typeid(ram_operation_load_t))
+        {
+            const ram_operation_load_t &op = dynamic_cast<const ram_operation_load_t &>(operation);
+            opcode_ = ram_load;
+            arguments_ = {op.reg_destination(), op.reg_source(), 0};
+        }
+
+        else if (type == typeid(ram_operation_store_t))
+        {
+            const ram_operation_store_t &op =
+                dynamic_cast<const ram_operation_store_t &>(operation);
+            opcode_ = ram_store;
+            arguments_ = {op.reg_destination(), op.reg_source(), 0};
+        }
+
+        else if (type == typeid(ram_operation_add_t))
+        {
+            const ram_operation_add_t &op = dynamic_cast<const ram_operation_add_t &>(operation);
+            opcode_ = ram_add;
+            arguments_ = {op.reg_destination(), op.reg_source_0(), op.reg_source_1()};
+        }
+
+        else if (type == typeid(ram_operation_sub_t))
+        {
+            const ram_operation_sub_t &op = dynamic_cast<const ram_operation_sub_t &>(operation);
+            opcode_ = ram_sub;
+            arguments_ = {op.reg_destination(), op.reg_source_0(), op.reg_source_1()};
+        }
+
+        else if (type == typeid(ram_operation_halve_t))
+        {
+            const ram_operation_halve_t &op =
+                dynamic_cast<const ram_operation_halve_t &>(operation);
+            opcode_ = ram_halve;
+            arguments_ = {op.reg_destination(), op.reg_source(), 0};
+        }
+
+        else if (type == typeid(ram_operation_set_0_t))
+        {
+            opcode_ = ram_set_0;
+            arguments_[0] =
+                dynamic_cast<const ram_operation_set_0_t &>(operation).reg_destination();
+        }
+
+        else if (type == typeid(ram_operation_set_1_t))
+        {
+            opcode_ = ram_set_1;
+            arguments_[0] =
+                dynamic_cast<const ram_operation_set_1_t &>(operation).reg_destination();
+        }
+
+        else if (type == typeid(ram_operation_test_gr_t))
+        {
+            const ram_operation_test_gr_t &op =
+                dynamic_cast<const ram_operation_test_gr_t &>(operation);
+            opcode_ = ram_test_gr;
+            arguments_ = {op.reg_source_0(), op.reg_source_1(), 0};
+        }
+
+        else if (type == typeid(ram_operation_test_eq_t))
+        {
+            const ram_operation_test_eq_t &op =
+                dynamic_cast<const ram_operation_test_eq_t &>(operation);
+            opcode_ = ram_test_eq;
+            arguments_ = {op.reg_source_0(), op.reg_source_1(), 0};
+        }
+
+        else if (type == typeid(ram_operation_test_odd_t))
+        {
+            opcode_ = ram_test_odd;
+            arguments_[0] = dynamic_cast<const ram_operation_test_odd_t &>(operation).reg_source();
+        }
+
+        else if (type == typeid(ram_operation_test_even_t))
+        {
+            opcode_ = ram_test_even;
+            arguments_[0] = dynamic_cast<const ram_operation_test_even_t &>(operation).reg_source();
+        }
+
+        else
+            throw std::runtime_error{"In Machine::code_t::code_t(const operation_t &):\n"
+                "Unknown operation.\n"};
+
+        return;
+    }
+
+    code_t::opcode_t code_t::opcode() const noexcept { return opcode_; }
+
+    index_t code_t::argument(index_t arg) const noexcept { return arguments_[arg]; }
+
+    bool code_t::valid(const device_t &device) const
+    {
+        using enum opcode_t;
+
+        index_t c;
+
+        switch (opcode_)
+        {
+            case output_write:
+            case stack_push:
+            case queue_enqueue:
+            case tape_print:
+                c = arguments_[0];
+                break;
+
+            case tape_compound:
+                if (not (arguments_[0] & compound_print))
+                    return true;
+
+                c = arguments_[2];
+                break;
+
+            default:
+                return true;
+        }
+
+        return c <= device.encoder().alphabet().max_character();
+    }
+
+    bool code_t::applicable(const device_t &device) const
+    {
+        using enum opcode_t;
+
+        switch (opcode_)
+        {
+            case noop:
+            case output_write:
+            case stack_push:
+            case queue_enqueue:
+            case unsigned_counter_inc:
+            case counter_inc:
+            case counter_dec:
+            case tape_print:
+            case tape_move_r:
+            case ram_load:
+            case ram_store:
+            case ram_add:
+            case ram_sub:
+            case ram_halve:
+            case ram_set_0:
+            case ram_set_1:
+                return true;
+
+            case control:
+                return static_cast<const control_t &>(device).state() == arguments_[0];
+
+            case input_scan:
+            case input_next:
+                return static_cast<const input_t &>(device).see(arguments_[0]);
+
+            case input_eof:
+                return static_cast<const input_t &>(device).empty();
+
+            case stack_pop:
+            case stack_top:
+                return static_cast<const stack_t &>(device).string().see(arguments_[0]);
+
+            case stack_empty:
+                return static_cast<const stack_t &>(device).string().empty();
+
+            case queue_dequeue:
+            {
+                const Apparatus::packed_vector_t &queue =
+                    static_cast<const queue_t &>(device).queue();
+                return not std::empty(queue) and queue.front() == arguments_[0];
+            }
+
+            case queue_empty:
+                return std::empty(static_cast<const queue_t &>(device).queue());
+
+            case unsigned_counter_dec:
+            case unsigned_counter_non_zero:
+                return not static_cast<const unsigned_counter_t &>(device).state().zero();
+
+            case unsigned_counter_zero:
+                return static_cast<const unsigned_counter_t &>(device).state().zero();
+
+            case counter_zero:
+                return static_cast<const counter_t &>(device).state().zero();
+
+            case counter_pos:
+                return static_cast<const counter_t &>(device).state().pos();
+
+            case counter_neg:
+                return static_cast<const counter_t &>(device).state().neg();
+
+            case tape_see:
+                return static_cast<const tape_t &>(device).string().see(arguments_[0]);
+
+            case tape_move_l:
+                return static_cast<const tape_t &>(device).string().pos() != 0;
+
+            case tape_athome:
+                return static_cast<const tape_t &>(device).string().athome();
+
+            case tape_compound:
+            {
+                const string_t &string = static_cast<const tape_t &>(device).string();
+
+                if ((arguments_[0] & compound_athome) and not string.athome())
+                    return false;
+
+                if ((arguments_[0] & compound_see) and not string.see(arguments_[1]))
+                    return false;
+
+                return not ((arguments_[0] & compound_move_l) and string.athome());
+            }
+
+            case ram_test_gr:
+            {
+                const std::vector<unsigned_number_t> &r =
+                    static_cast<const ram_t &>(device).registers();
+                return r[arguments_[0]] > r[arguments_[1]];
+            }
+
+            case ram_test_eq:
+            {
+                const std::vector<unsigned_number_t> &r =
+                    static_cast<const ram_t &>(device).registers();
+                return r[arguments_[0]] == r[arguments_[1]];
+            }
+
+            case ram_test_odd:
+                return static_cast<const ram_t &>(device).registers()[arguments_[0]].odd();
+
+            case ram_test_even:
+                return not static_cast<const ram_t &>(device).registers()[arguments_[0]].odd();
+        }
+
+        std::unreachable();
+    }
+
+    void code_t::reserve(device_t &device) const
+    {
+        using enum opcode_t;
+
+        switch (opcode_)
+        {
+            case ram_load:
+            case ram_store:
+            case ram_add:
+            case ram_sub:
+            case ram_halve:
+            case ram_set_0:
+            case ram_set_1:
+            case ram_test_gr:
+            case ram_test_eq:
+            case ram_test_odd:
+            case ram_test_even:
+                static_cast<ram_t &>(device).reserve(std::ranges::max(arguments_) + 1);
+                return;
+
+            default:
+                return;
+        }
+    }
+
+    index_t code_t::repetitions(const device_t &device) const
+    {
+        using enum opcode_t;
+
+        switch (opcode_)
+        {
+            case noop:
+            case input_next:
+            case input_eof:
+            case output_write:
+            case stack_push:
+            case stack_top:
+            case stack_empty:
+            case queue_enqueue:
+            case queue_empty:
+            case unsigned_counter_inc:
+            case unsigned_counter_zero:
+            case unsigned_counter_non_zero:
+            case counter_inc:
+            case counter_dec:
+            case counter_zero:
+            case counter_pos:
+            case counter_neg:
+            case tape_see:
+            case tape_print:
+            case tape_move_r:
+            case tape_athome:
+            case ram_test_gr:
+            case ram_test_eq:
+            case ram_test_odd:
+            case ram_test_even:
+                return negative_1;
+
+            case control:
+                return arguments_[0] == arguments_[1] ? negative_1 : 1;
+
+            case input_scan:
+                return static_cast<const input_t &>(device).run(arguments_[0]);
+
+            case stack_pop:
+                return static_cast<const stack_t &>(device).string().run_backward(arguments_[0]);
+
+            case queue_dequeue:
+                return static_cast<const queue_t &>(device).queue().count_forward(0, arguments_[0]);
+
+            case unsigned_counter_dec:
+            {
+                const unsigned_number_t::digits_t &digits =
+                    static_cast<const unsigned_counter_t &>(device).state().digits();
+
+                return std::size(digits) == 1 ?
+                    std::min(digits.front(), machine_t::max_unbounded_steps) :
+                    machine_t::max_unbounded_steps;
+            }
+
+            case tape_move_l:
+                return static_cast<const tape_t &>(device).string().pos();
+
+            case tape_compound:
+            {
+                const tape_t &tape = static_cast<const tape_t &>(device);
+                const string_t &string = tape.string();
+                const bool see = arguments_[0] & compound_see;
+
+                if (not (arguments_[0] & (compound_move_l | compound_move_r)))
+                    return see and (arguments_[0] & compound_print) and
+                        arguments_[1] != arguments_[2] ? 1 : negative_1;
+
+                if (arguments_[0] & compound_athome)
+                    return 1;
+
+                if (arguments_[0] & compound_move_l)
+                    return see ?
+                        std::min(string.run_backward(arguments_[1]), string.pos()) : string.pos();
+
+                if (not see)
+                    return negative_1;
+
+                const index_t run = string.run_forward(arguments_[1]);
+
+                return string.pos() + run == std::size(string) and
+                    arguments_[1] == tape.default_character() ? negative_1 : run;
+            }
+
+            default:
+                return 1;
+        }
+    }
+
+    void code_t::apply(device_t &device) const
+    {
+        using enum opcode_t;
+
+        switch (opcode_)
+        {
+            case control:
+                static_cast<control_t &>(device).state() = arguments_[1];
+                return;
+
+            case input_scan:
+                static_cast<input_t &>(device).pop();
+                return;
+
+            case noop:
+            case input_next:
+            case input_eof:
+            case stack_top:
+            case stack_empty:
+            case queue_empty:
+            case unsigned_counter_zero:
+            case unsigned_counter_non_zero:
+            case counter_zero:
+            case counter_pos:
+            case counter_neg:
+            case tape_see:
+            case tape_athome:
+            case ram_test_gr:
+            case ram_test_eq:
+            case ram_test_odd:
+            case ram_test_even:
+                return;
+
+            case output_write:
+                static_cast<output_t &>(device).string().push_unchecked(arguments_[0]);
+                return;
+
+            case stack_push:
+                static_cast<stack_t &>(device).string().push_unchecked(arguments_[0]);
+                return;
+
+            case stack_pop:
+                static_cast<stack_t &>(device).string().pop_unchecked();
+                return;
+
+            case queue_enqueue:
+                static_cast<queue_t &>(device).queue().push_back(arguments_[0]);
+                return;
+
+            case queue_dequeue:
+                static_cast<queue_t &>(device).queue().pop_front();
+                return;
+
+            case unsigned_counter_inc:
+                ++static_cast<unsigned_counter_t &>(device).state();
+                return;
+
+            case unsigned_counter_dec:
+                --static_cast<unsigned_counter_t &>(device).state();
+                return;
+
+            case counter_inc:
+                ++static_cast<counter_t &>(device).state();
+                return;
+
+            case counter_dec:
+                --static_cast<counter_t &>(device).state();
+                return;
+
+            case tape_print:
+                static_cast<tape_t &>(device).string().print_unchecked(arguments_[0]);
+                return;
+
+            case tape_move_l:
+                static_cast<tape_t &>(device).string().move_l();
+                return;
+
+            case tape_move_r:
+            {
+                tape_t &tape = static_cast<tape_t &>(device);
+                tape.string().move_r_unchecked(tape.default_character());
+                return;
+            }
+
+            case tape_compound:
+            {
+                tape_t &tape = static_cast<tape_t &>(device);
+
+                if (arguments_[0] & compound_print)
+                    tape.string().print_unchecked(arguments_[2]);
+
+                if (arguments_[0] & compound_move_l)
+                    tape.string().move_l();
+                else if (arguments_[0] & compound_move_r)
+                    tape.string().move_r_unchecked(tape.default_character());
+
+                return;
+            }
+
+            case ram_load:
+            {
+                ram_t &ram = static_cast<ram_t &>(device);
+                std::vector<unsigned_number_t> &r = ram.registers();
+                r[arguments_[0]] = ram.memory().load(r[arguments_[1]]);
+                return;
+            }
+
+            case ram_store:
+            {
+                ram_t &ram = static_cast<ram_t &>(device);
+                const std::vector<unsigned_number_t> &r = std::as_const(ram).registers();
+                ram.memory().store(r[arguments_[0]], r[arguments_[1]]);
+                return;
+            }
+
+            case ram_add:
+            {
+                std::vector<unsigned_number_t> &r = static_cast<ram_t &>(device).registers();
+
+                if (arguments_[1] == arguments_[2])
+                    r[arguments_[0]] = r[arguments_[1]] << 1;
+                else if (arguments_[0] == arguments_[1])
+                    r[arguments_[0]] += r[arguments_[2]];
+                else if (arguments_[0] == arguments_[2])
+                    r[arguments_[0]] += r[arguments_[1]];
+                else
+                    r[arguments_[0]] = r[arguments_[1]] + r[arguments_[2]];
+
+                return;
+            }
+
+            case ram_sub:
+            {
+                std::vector<unsigned_number_t> &r = static_cast<ram_t &>(device).registers();
+
+                if (r[arguments_[1]] <= r[arguments_[2]])
+                    r[arguments_[0]] = 0;
+                else if (arguments_[0] == arguments_[1])
+                    r[arguments_[0]] -= r[arguments_[2]];
+                else
+                    r[arguments_[0]] = r[arguments_[1]] - r[arguments_[2]];
+
+                return;
+            }
+
+            case ram_halve:
+            {
+                std::vector<unsigned_number_t> &r = static_cast<ram_t &>(device).registers();
+
+                if (arguments_[0] == arguments_[1])
+                    r[arguments_[0]] >>= 1;
+                else
+                    r[arguments_[0]] = r[arguments_[1]] >> 1;
+
+                return;
+            }
+
+            case ram_set_0:
+                static_cast<ram_t &>(device).registers()[arguments_[0]] = 0;
+                return;
+
+            case ram_set_1:
+                static_cast<ram_t &>(device).registers()[arguments_[0]] = 1;
+                return;
+        }
+
+        std::unreachable();
+    }
+
+    void code_t::apply(device_t &device, index_t n) const
+    {
+        using enum opcode_t;
+
+        switch (opcode_)
+        {
+            case noop:
+            case control:
+            case input_next:
+            case input_eof:
+            case stack_top:
+            case stack_empty:
+            case queue_empty:
+            case unsigned_counter_zero:
+            case unsigned_counter_non_zero:
+            case counter_zero:
+            case counter_pos:
+            case counter_neg:
+            case tape_see:
+            case tape_print:
+            case tape_athome:
+            case ram_test_gr:
+            case ram_test_eq:
+            case ram_test_odd:
+            case ram_test_even:
+                return apply(device);
+
+            case input_scan:
+                static_cast<input_t &>(device).pop(n);
+                return;
+
+            case output_write:
+                static_cast<output_t &>(device).string().push_unchecked(arguments_[0], n);
+                return;
+
+            case stack_push:
+                static_cast<stack_t &>(device).string().push_unchecked(arguments_[0], n);
+                return;
+
+            case stack_pop:
+                static_cast<stack_t &>(device).string().pop_unchecked(n);
+                return;
+
+            case queue_enqueue:
+            {
+                Apparatus::packed_vector_t &queue = static_cast<queue_t &>(device).queue();
+                queue.resize(std::size(queue) + n, arguments_[0]);
+                return;
+            }
+
+            case queue_dequeue:
+                static_cast<queue_t &>(device).queue().pop_front(n);
+                return;
+
+            case unsigned_counter_inc:
+                static_cast<unsigned_counter_t &>(device).state() += n;
+                return;
+
+            case unsigned_counter_dec:
+                static_cast<unsigned_counter_t &>(device).state() -= n;
+                return;
+
+            case counter_inc:
+                static_cast<counter_t &>(device).state() += unsigned_number_t{n};
+                return;
+
+            case counter_dec:
+                static_cast<counter_t &>(device).state() -= unsigned_number_t{n};
+                return;
+
+            case tape_move_l:
+                static_cast<tape_t &>(device).string().move_l_unchecked(n);
+                return;
+
+            case tape_move_r:
+            {
+                tape_t &tape = static_cast<tape_t &>(device);
+                tape.string().move_r_unchecked(tape.default_character(), n);
+                return;
+            }
+
+            case tape_compound:
+            {
+                tape_t &tape = static_cast<tape_t &>(device);
+                const bool print = arguments_[0] & compound_print;
+
+                if (arguments_[0] & compound_move_l)
+                {
+                    if (print)
+                        tape.string().print_l_unchecked(arguments_[2], n);
+                    else
+                        tape.string().move_l_unchecked(n);
+                }
+
+                else if (arguments_[0] & compound_move_r)
+                {
+                    if (print)
+                        tape.string().print_r_unchecked(arguments_[2],
+                            tape.default_character(), n);
+                    else
+                        tape.string().move_r_unchecked(tape.default_character(), n);
+                }
+
+                else
+                    apply(device);
+
+                return;
+            }
+
+            default:
+                for (index_t i = 0; i != n; ++i)
+                    apply(device);
+                return;
+        }
+    }
+
+    static index_t bit_width(const unsigned_number_t &arg)
+    {
+        const unsigned_number_t::digits_t &digits = arg.digits();
+
+        if (std::empty(digits))
+            return 0;
+
+        return (std::size(digits) - 1) * std::numeric_limits<index_t>::digits +
+            std::bit_width(digits.back());
+    }
+
+    static bool bit(const unsigned_number_t &arg, index_t i)
+    {
+        static constexpr index_t n_digits = std::numeric_limits<index_t>::digits;
+
+        const unsigned_number_t::digits_t &digits = arg.digits();
+        return i / n_digits < std::size(digits) and (digits[i / n_digits] >> i % n_digits & 1);
+    }
+
+    static index_t popcount(const unsigned_number_t &arg)
+    {
+        index_t ret = 0;
+
+        for (index_t i : arg.digits())
+            ret += std::popcount(i);
+
+        return ret;
+    }
+
     machine_t::program_t::program_t(const std::vector<std::unique_ptr<device_t>> &devices,
             std::vector<std::shared_ptr<operation_t>> instruction_set) :
         instruction_set_{std::move(instruction_set)},
         first_control_{0},
         deterministic_{true}
     {
-        auto throw_error = [&](const std::string &arg) -> void
+        auto throw_error = [&](const std::string &arg) -> void
+        {
+            throw std::runtime_error{std::string{"In Machine::program_t::program_t("
+                "const std::vector<std::unique_ptr<device_t>> &, "
+                "std::vector<std::shared_ptr<operation_t>>,"
+                "std::unique_ptr<encoder_t>):\n"} + arg + "\n"};
+        };
+
+        index_t n = std::size(devices);
+        index_t s = std::size(instruction_set_);
+        if (n == 0)
+            throw_error("Machine without any device.");
+
+        if (s % n != 0)
+            throw_error("The number of instructions is not a multiple of the number of devices.");
+
+        for (; first_control_ != n; ++first_control_)
+            if (typeid(*devices[first_control_]) == typeid(control_t))
+                break;
+
+        if (first_control_ == n)
+            first_control_ = negative_1;
+
+        index_t n_states_first_control = 0;
+        if (first_control_ != negative_1)
+            n_states_first_control =
+                dynamic_cast<control_t &>(*devices[first_control_]).initialiser().initial_state();
+
+        for (auto i = std::cbegin(instruction_set_); i < std::cend(instruction_set_); i += n)
+        {
+            auto j = i;
+            for (auto k = std::cbegin(devices); k != std::cend(devices); ++k, ++j)
+                if (not (**j).correct_device(**k))
+                    throw invalid_operation_t{**j, **k};
+
+            if (first_control_ != negative_1)
+            {
+                const control_operation_t &control_operation = 
+                        dynamic_cast<const control_operation_t &>(**(i + first_control_));
+                n_states_first_control = std::max(n_states_first_control,
+                        std::max(control_operation.from(), control_operation.to()));
+            }
+
+            for (j = std::cbegin(instruction_set_); j < i and deterministic_; j += n)
+                deterministic_ = not std::equal(i, i + n, j,
+                    [](const auto &a, const auto &b)
+                        { return (*a).intersecting_domain(*b); });
+
+            if (deterministic_)
+                deterministic_ = not std::equal(i, i + n, std::cbegin(devices),
+                    [](const auto &a, const auto &b)
+                        { return (*a).intersecting_domain((*b).terminator()); });
+        }
+
+        computation_bits_ = std::bit_width(std::size(instruction_set_) / n);
+
+        if (first_control_ != negative_1)
+        {
+            ++n_states_first_control;
+
+            instruction_set_radix_sort(
+                    instruction_set_, first_control_, n_states_first_control, n);
+
+            for (auto i = std::begin(instruction_set_); i != std::end(instruction_set_); i += n)
+                while (dynamic_cast<control_operation_t &>(**(i + first_control_)).from() >=
+                        std::size(search_table_))
+                    search_table_.emplace_back(i);
+            while (n_states_first_control >= std::size(search_table_))
+                search_table_.emplace_back(std::end(instruction_set_));
+        }
+
+        code_.reserve(std::size(instruction_set_));
+        for (const std::shared_ptr<operation_t> &i : instruction_set_)
+        {
+            const device_t &device = *devices[std::size(code_) % n];
+
+            if (not code_.emplace_back(*i).valid(device))
+                throw invalid_operation_t{*i, device};
+        }
+
+        compile_dispatch_table(devices);
+        compile_fusions(devices);
+
+        return;
+    }
+
+    void machine_t::program_t::compile_dispatch_table(
+            const std::vector<std::unique_ptr<device_t>> &devices)
+    {
+        static constexpr index_t max_table_size = index_t{1} << 20;
+
+        if (not deterministic_ or first_control_ == negative_1)
+            return;
+
+        index_t n = std::size(devices);
+        index_t n_states = std::size(search_table_) - 1;
+        index_t n_keys = 1;
+        std::vector<index_t> weights(n, 0);
+        std::vector<index_t> n_observations(n, 0);
+
+        for (index_t i = 0; i != n; ++i)
+        {
+            if (i == first_control_)
+                continue;
+
+            n_observations[i] = devices[i]->n_observations();
+            if (n_observations[i] == 0 or n_keys > max_table_size / n_observations[i])
+                return;
+
+            weights[i] = n_keys;
+            n_keys *= n_observations[i];
+        }
+
+        if (n_states > max_table_size / n_keys)
+            return;
+
+        weights[first_control_] = n_keys;
+
+        std::vector<std::unique_ptr<device_t>> witnesses;
+        witnesses.reserve(n);
+        for (const std::unique_ptr<device_t> &i : devices)
+            witnesses.emplace_back(i->clone());
+
+        std::vector<index_t> table(n_states * n_keys, negative_1);
+        auto entry = std::begin(table);
+
+        for (index_t state = 0; state != n_states; ++state)
+        {
+            witnesses[first_control_]->observe(state);
+
+            auto begin = std::cbegin(code_) +
+                std::distance(std::cbegin(instruction_set_), search_table_[state]);
+            auto end = std::cbegin(code_) +
+                std::distance(std::cbegin(instruction_set_), search_table_[state + 1]);
+
+            for (index_t key = 0; key != n_keys; ++key, ++entry)
+            {
+                for (index_t i = 0; i != n; ++i)
+                    if (i != first_control_)
+                        witnesses[i]->observe(key / weights[i] % n_observations[i]);
+
+                for (auto i = begin; i < end; i += n)
+                    if (std::equal(i, i + n, std::cbegin(witnesses),
+                                [](const code_t &a, const auto &b) { return a.applicable(*b); }))
+                    {
+                        if (*entry != negative_1)
+                            return;
+
+                        *entry = std::distance(std::cbegin(code_), i);
+                    }
+
+                if (std::ranges::all_of(witnesses, [](const auto &i) { return i->terminating(); }))
+                {
+                    if (*entry != negative_1)
+                        return;
+
+                    *entry = std::size(instruction_set_);
+                }
+            }
+        }
+
+        dispatch_table_ = std::move(table);
+        dispatch_weights_ = std::move(weights);
+
+        return;
+    }
+
+    void machine_t::program_t::compile_fusions(
+            const std::vector<std::unique_ptr<device_t>> &devices)
+    {
+        using enum code_t::opcode_t;
+
+        if (not deterministic_ or first_control_ == negative_1)
+            return;
+
+        const index_t n = std::size(devices);
+        const index_t s = std::size(instruction_set_) / n;
+
+        auto at = [&](index_t instruction, index_t device) -> const code_t &
+            { return code_[instruction * n + device]; };
+
+        auto target = [&](index_t instruction) -> index_t
+            { return at(instruction, first_control_).argument(1); };
+
+        auto plain = [&](index_t instruction, index_t device) -> bool
         {
-            throw std::runtime_error{std::string{"In Machine::program_t::program_t("
-                "const std::vector<std::unique_ptr<device_t>> &, "
-                "std::vector<std::shared_ptr<operation_t>>,"
-                "std::unique_ptr<encoder_t>):\n"} + arg + "\n"};
-        };
+            for (index_t i = 0; i != n; ++i)
+                if (i != first_control_ and i != device and at(instruction, i).opcode() != noop)
+                    return false;
 
-        index_t n = std::size(devices);
-        index_t s = std::size(instruction_set_);
-        if (n == 0)
-            throw_error("Machine without any device.");
+            return typeid(*devices[device]) == typeid(ram_t);
+        };
 
-        if (s % n != 0)
-            throw_error("The number of instructions is not a multiple of the number of devices.");
+        auto transitions = [&](index_t state) -> std::array<index_t, 2>
+        {
+            const auto begin = std::cbegin(instruction_set_);
+            return {index_t(std::distance(begin, search_table_[state])) / n,
+                index_t(std::distance(begin, search_table_[state + 1])) / n};
+        };
 
-        for (; first_control_ != n; ++first_control_)
-            if (typeid(*devices[first_control_]) == typeid(control_t))
-                break;
+        auto single = [&](index_t state, index_t device) -> index_t
+        {
+            const auto [begin, end] = transitions(state);
+            return end - begin == 1 and plain(begin, device) ? begin : negative_1;
+        };
 
-        if (first_control_ == n)
-            first_control_ = negative_1;
+        auto distinct = [](std::initializer_list<index_t> arg) -> bool
+        {
+            for (auto i = std::begin(arg); i != std::end(arg); ++i)
+                if (*i != negative_1 and std::find(std::begin(arg), i, *i) != i)
+                    return false;
 
-        index_t n_states_first_control = 0;
-        if (first_control_ != negative_1)
-            n_states_first_control =
-                dynamic_cast<control_t &>(*devices[first_control_]).initialiser().initial_state();
+            return true;
+        };
 
-        for (auto i = std::cbegin(instruction_set_); i < std::cend(instruction_set_); i += n)
+        auto match_multiply = [&](index_t gr, index_t r, fusion_t &fusion) -> bool
         {
-            auto j = i;
-            for (auto k = std::cbegin(devices); k != std::cend(devices); ++k, ++j)
-                if (not (**j).correct_device(**k))
-                    throw invalid_operation_t{**j, **k};
+            const index_t b = at(gr, r).argument(0);
+            const index_t z = at(gr, r).argument(1);
+            const auto [begin, end] = transitions(target(gr));
+
+            if (end - begin != 2 or not plain(begin, r) or not plain(begin + 1, r))
+                return false;
+
+            index_t odd = begin;
+            index_t even = begin + 1;
+            if (at(odd, r).opcode() != ram_test_odd)
+                std::swap(odd, even);
+
+            if (at(odd, r).opcode() != ram_test_odd or at(even, r).opcode() != ram_test_even or
+                at(odd, r).argument(0) != b or at(even, r).argument(0) != b)
+                return false;
+
+            const index_t add_c = single(target(odd), r);
+            if (add_c == negative_1 or at(add_c, r).opcode() != ram_add or
+                target(add_c) != target(even))
+                return false;
+
+            const index_t c = at(add_c, r).argument(0);
+            const index_t a = at(add_c, r).argument(1) == c ?
+                at(add_c, r).argument(2) : at(add_c, r).argument(1);
+            if ((at(add_c, r).argument(1) == c) == (at(add_c, r).argument(2) == c))
+                return false;
+
+            const index_t halve = single(target(even), r);
+            if (halve == negative_1 or at(halve, r).opcode() != ram_halve or
+                at(halve, r).argument(0) != b or at(halve, r).argument(1) != b)
+                return false;
+
+            const index_t add_a = single(target(halve), r);
+            if (add_a == negative_1 or at(add_a, r).opcode() != ram_add or
+                at(add_a, r).argument(0) != a or at(add_a, r).argument(1) != a or
+                at(add_a, r).argument(2) != a or
+                target(add_a) != at(gr, first_control_).argument(0))
+                return false;
+
+            if (not distinct({a, b, c, z}))
+                return false;
+
+            fusion = {fusion_kind_t::multiply, r, {a, b, c, z},
+                {gr, odd, add_c, even, halve, add_a}};
+            return true;
+        };
 
-            if (first_control_ != negative_1)
+        auto match_count = [&](index_t gr, index_t r, fusion_t &fusion) -> bool
+        {
+            const index_t b = at(gr, r).argument(0);
+            const index_t z = at(gr, r).argument(1);
+            index_t a = negative_1;
+            index_t o = negative_1;
+            index_t addend = negative_1;
+            std::vector<index_t> body{gr};
+
+            for (index_t state = target(gr); state != at(gr, first_control_).argument(0);)
             {
-                const control_operation_t &control_operation = 
-                        dynamic_cast<const control_operation_t &>(**(i + first_control_));
-                n_states_first_control = std::max(n_states_first_control,
-                        std::max(control_operation.from(), control_operation.to()));
+                const index_t i = single(state, r);
+                if (i == negative_1 or std::size(body) == 3)
+                    return false;
+
+                const code_t &code = at(i, r);
+                const index_t d = code.argument(0);
+
+                if (code.opcode() == ram_sub and o == negative_1 and d == b and
+                    code.argument(1) == b)
+                    o = code.argument(2);
+                else if (code.opcode() == ram_add and a == negative_1 and
+                    (code.argument(1) == d) != (code.argument(2) == d))
+                {
+                    a = d;
+                    addend = code.argument(code.argument(1) == d ? 2 : 1);
+                }
+                else
+                    return false;
+
+                body.emplace_back(i);
+                state = target(i);
             }
 
-            for (j = std::cbegin(instruction_set_); j < i and deterministic_; j += n)
-                deterministic_ = not std::equal(i, i + n, j,
-                    [](const auto &a, const auto &b)
-                        { return (*a).intersecting_domain(*b); });
+            if (o == negative_1 or (a != negative_1 and addend != o) or not distinct({a, b, o, z}))
+                return false;
 
-            if (deterministic_)
-                deterministic_ = not std::equal(i, i + n, std::cbegin(devices),
-                    [](const auto &a, const auto &b)
-                        { return (*a).intersecting_domain((*b).terminator()); });
-        }
+            fusion = {fusion_kind_t::count, r, {a, b, o, z}, std::move(body)};
+            return true;
+        };
 
-        computation_bits_ = std::bit_width(std::size(instruction_set_) / n);
+        std::vector<index_t> table(s, negative_1);
 
-        if (first_control_ == negative_1)
-            return;
+        for (index_t i = 0; i != s; ++i)
+            for (index_t r = 0; r != n; ++r)
+                if (at(i, r).opcode() == ram_test_gr and plain(i, r))
+                {
+                    fusion_t fusion;
+
+                    if (match_multiply(i, r, fusion) or match_count(i, r, fusion))
+                    {
+                        table[i] = std::size(fusions_);
+                        fusions_.emplace_back(std::move(fusion));
+                    }
 
-        ++n_states_first_control;
+                    break;
+                }
 
-        instruction_set_radix_sort(instruction_set_, first_control_, n_states_first_control, n);
+        if (std::empty(fusions_))
+            return;
 
-        for (auto i = std::begin(instruction_set_); i != std::end(instruction_set_); i += n)
-            while (dynamic_cast<control_operation_t &>(**(i + first_control_)).from() >=
-                    std::size(search_table_))
-                search_table_.emplace_back(i);
-        while (n_states_first_control >= std::size(search_table_))
-            search_table_.emplace_back(std::end(instruction_set_));
+        fusion_table_ = std::move(table);
+        fired_ = std::vector<std::atomic<index_t>>(std::size(fusions_));
 
         return;
     }
@@ -2781,7 +3849,16 @@ namespace Machine
             std::vector<std::shared_ptr<operation_t>> instruction_set) :
         devices_{std::move(devices)},
         program_{std::make_shared<program_t>(devices_, std::move(instruction_set))},
-        output_(std::size(devices_), "") {}
+        output_(std::size(devices_), "")
+    {
+        auto code = std::cbegin(program_->code());
+
+        while (code != std::cend(program_->code()))
+            for (const std::unique_ptr<device_t> &i : devices_)
+                (code++)->reserve(*i);
+
+        return;
+    }
     
     machine_t::machine_t(std::ifstream &stream) : program_{nullptr}
     {
@@ -2936,6 +4013,43 @@ namespace Machine
                                devices_[arg]->encoder());
     }
 
+    std::vector<std::string> machine_t::print_fusions() const
+    {
+        std::vector<std::string> ret;
+
+        if (not program_)
+            return ret;
+
+        const index_t n = std::size(devices_);
+
+        for (index_t i = 0; i != std::size(program_->fusions()); ++i)
+        {
+            const program_t::fusion_t &f = program_->fusions()[i];
+            const auto [a, b, c, z] = f.registers_;
+            const index_t state =
+                program_->code()[f.instructions_[0] * n + program_->first_control()].argument(0);
+
+            std::string str = "Fused loop at state " + std::to_string(state) + ": ";
+
+            if (f.kind_ == program_t::fusion_kind_t::multiply)
+                str += "r" + std::to_string(c) + " += r" + std::to_string(a) + " * r" +
+                    std::to_string(b);
+            else
+            {
+                str += "r" + std::to_string(b) + " -= t * r" + std::to_string(c);
+                if (a != negative_1)
+                    str += ", r" + std::to_string(a) + " += t * r" + std::to_string(c);
+            }
+
+            str += " while r" + std::to_string(b) + " > r" + std::to_string(z) + "; fired " +
+                std::to_string(program_->fired()[i].load(std::memory_order_relaxed)) + " times";
+
+            ret.emplace_back(std::move(str));
+        }
+
+        return ret;
+    }
+
     const std::vector<std::unique_ptr<device_t>> &machine_t::devices() const noexcept
         { return devices_; }
 
@@ -3001,10 +4115,10 @@ namespace Machine
         else
         {
             auto i = std::begin(devices_);
-            auto j = std::begin(program_->instruction_set()) + next_instruction_;
+            auto j = std::cbegin(program_->code()) + next_instruction_;
 
             for (; i != std::end(devices_); ++i, ++j)
-                (**j).apply(**i);
+                j->apply(**i);
 
             computation_append();
             applicable_instructions_apparatus();
@@ -3015,15 +4129,15 @@ namespace Machine
 
     void machine_t::next(index_t steps)
     {
-        for (index_t i = 0; i < steps and state_ == machine_state_t::running; ++i)
-            next();
+        for (index_t i = 0; i < steps and state_ == machine_state_t::running;)
+            i += advance(steps - i);
         return;
     }
 
     void machine_t::run()
     {
         while (state_ == machine_state_t::running)
-            next();
+            advance(negative_1);
         return;
     }
 
@@ -3135,6 +4249,67 @@ namespace Machine
     index_t machine_t::computation_size() const
         { return computation_size_ / program_->computation_bits(); }
 
+    std::vector<index_t> machine_t::configuration() const
+    {
+        std::vector<index_t> ret;
+
+        for (const auto &i : devices_)
+            i->configuration(ret);
+
+        return ret;
+    }
+
+    std::vector<index_t> machine_t::serialise() const
+    {
+        if (state_ != machine_state_t::running)
+            throw std::runtime_error{"In Machine::machine_t::serialise() const:\n"
+                "Only running machines can be serialised.\n"};
+
+        std::vector<index_t> ret;
+        ret.emplace_back(computation_size_);
+        ret.emplace_back(std::size(computation_));
+
+        for (index_t i = 0; i != std::size(computation_); ++i)
+            ret.emplace_back(computation_[i]);
+
+        for (const auto &i : devices_)
+            i->configuration(ret);
+
+        return ret;
+    }
+
+    void machine_t::deserialise(std::span<const index_t> arg)
+    {
+        computation_.clear();
+        computation_size_ = arg[0];
+
+        for (index_t i = 0; i != arg[1]; ++i)
+            computation_.push_back(arg[2 + i]);
+
+        arg = arg.subspan(2 + arg[1]);
+
+        for (auto &i : devices_)
+            i->restore_configuration(arg);
+
+        if (not std::empty(arg))
+            throw std::runtime_error{"In Machine::machine_t::deserialise("
+                "std::span<const index_t>):\nInvalid argument.\n"};
+
+        for (std::string &s : output_)
+            s.clear();
+
+        state_ = machine_state_t::running;
+        applicable_instructions_apparatus();
+
+        return;
+    }
+
+    index_t machine_t::footprint() const
+    {
+        return sizeof(machine_t) + std::size(devices_) * sizeof(std::unique_ptr<device_t>) +
+            (std::size(computation_) + std::size(configuration())) * sizeof(index_t);
+    }
+
     bool machine_t::terminating() const
         { return std::ranges::all_of(devices_, [](const auto &i) { return i->terminating(); }); }
 
@@ -3150,6 +4325,136 @@ namespace Machine
         return;
     }
 
+    index_t machine_t::advance(index_t steps)
+    {
+        if (not program_->deterministic() or
+            next_instruction_ >= std::size(program_->instruction_set()))
+        {
+            next();
+            return 1;
+        }
+
+        if (not std::empty(program_->fusion_table()))
+        {
+            const index_t fusion =
+                program_->fusion_table()[next_instruction_ / std::size(devices_)];
+
+            if (fusion != negative_1)
+                if (index_t fused = fuse(fusion, steps); fused != 0)
+                    return fused;
+        }
+
+        auto i = std::begin(devices_);
+        auto j = std::cbegin(program_->code()) + next_instruction_;
+        index_t bound = negative_1;
+
+        for (; i != std::end(devices_) and bound > 1; ++i, ++j)
+            bound = std::min(bound, j->repetitions(**i));
+
+        if (bound == negative_1 and steps > max_unbounded_steps)
+            steps = 1;
+        else
+            steps = std::min({steps, bound, max_unbounded_steps});
+
+        if (steps <= 1)
+        {
+            next();
+            return 1;
+        }
+
+        i = std::begin(devices_);
+        j = std::cbegin(program_->code()) + next_instruction_;
+
+        for (; i != std::end(devices_); ++i, ++j)
+            j->apply(**i, steps);
+
+        const index_t instruction = next_instruction_ / std::size(devices_);
+        computation_append(std::span<const index_t>{&instruction, 1}, steps);
+        applicable_instructions_apparatus();
+
+        return steps;
+    }
+
+    index_t machine_t::fuse(index_t fusion, index_t steps)
+    {
+        const program_t::fusion_t &f = program_->fusions()[fusion];
+        std::vector<unsigned_number_t> &r = static_cast<ram_t &>(*devices_[f.device_]).registers();
+        const auto [a, b, c, z] = f.registers_;
+        index_t ret = 0;
+
+        steps = std::min(steps, max_unbounded_steps);
+
+        if (f.kind_ == program_t::fusion_kind_t::multiply)
+        {
+            index_t j = bit_width(r[b]) - bit_width(r[z]);
+            if ((r[b] >> j) > r[z])
+                ++j;
+
+            const unsigned_number_t low = r[b] - ((r[b] >> j) << j);
+            ret = 4 * j + popcount(low);
+            if (ret > steps)
+                return 0;
+
+            std::vector<index_t> instructions;
+            instructions.reserve(ret);
+            for (index_t i = 0; i != j; ++i)
+            {
+                if (bit(low, i))
+                    instructions.insert(std::end(instructions),
+                        {f.instructions_[0], f.instructions_[1], f.instructions_[2]});
+                else
+                    instructions.insert(std::end(instructions),
+                        {f.instructions_[0], f.instructions_[3]});
+
+                instructions.insert(std::end(instructions),
+                    {f.instructions_[4], f.instructions_[5]});
+            }
+
+            r[c] += r[a] * low;
+            r[a] <<= j;
+            r[b] >>= j;
+
+            computation_append(instructions, 1);
+        }
+
+        else
+        {
+            if (r[c].zero())
+                return 0;
+
+            auto [t, remainder] = divide(r[b] - r[z], r[c]);
+            if (not remainder.zero())
+                ++t;
+
+            // A long loop is left for later calls, which find r[b] still above r[z]
+            const index_t length = std::size(f.instructions_);
+            const index_t cap = steps / length;
+            if (t.zero() or cap == 0)
+                return 0;
+
+            const index_t n = std::size(t.digits()) != 1 or t.digits()[0] > cap ?
+                cap : t.digits()[0];
+
+            ret = n * length;
+            const unsigned_number_t total = unsigned_number_t{n} * r[c];
+
+            if (a != negative_1)
+                r[a] += total;
+
+            if (r[b] <= total)
+                r[b] = 0;
+            else
+                r[b] -= total;
+
+            computation_append(f.instructions_, n);
+        }
+
+        program_->fired()[fusion].fetch_add(1, std::memory_order_relaxed);
+        applicable_instructions_apparatus();
+
+        return ret;
+    }
+
     void machine_t::applicable_instructions_apparatus()
     {
         applicable_instructions_.clear();
@@ -3158,6 +4463,24 @@ namespace Machine
         if (state_ != machine_state_t::running)
             return;
 
+        if (not std::empty(program_->dispatch_table()))
+        {
+            index_t key = 0;
+            auto weight = std::cbegin(program_->dispatch_weights());
+            for (auto i = std::cbegin(devices_); i != std::cend(devices_); ++i, ++weight)
+                key += *weight * (**i).observation();
+
+            next_instruction_ = program_->dispatch_table()[key];
+
+            if (next_instruction_ == negative_1)
+                state_ = machine_state_t::blocked;
+            else
+                applicable_instructions_.emplace_back(
+                        std::cbegin(program_->instruction_set()) + next_instruction_);
+
+            return;
+        }
+
         index_t n = std::size(devices_);
 
         std::vector<std::shared_ptr<operation_t>>::const_iterator begin_search, end_search;
@@ -3170,15 +4493,17 @@ namespace Machine
         else
         {
             index_t control_state =
-                dynamic_cast<control_t &>(*devices_[program_->first_control()]).state();
+                static_cast<const control_t &>(*devices_[program_->first_control()]).state();
             begin_search = program_->search_table()[control_state];
             end_search = program_->search_table()[control_state + 1];
         }
 
-        for (; begin_search < end_search; begin_search += n)
-            if (std::equal(begin_search, begin_search + n, std::cbegin(devices_),
-                        [](const auto &a, const auto &b)
-                        { return (*a).applicable(*b); }))
+        auto code = std::cbegin(program_->code()) +
+            std::distance(std::cbegin(program_->instruction_set()), begin_search);
+
+        for (; begin_search < end_search; begin_search += n, code += n)
+            if (std::equal(code, code + n, std::cbegin(devices_),
+                        [](const code_t &a, const auto &b) { return a.applicable(*b); }))
             {
                 applicable_instructions_.emplace_back(begin_search);
                 if (next_instruction_ == negative_1)
@@ -3215,17 +4540,54 @@ namespace Machine
         index_t to_append = next_instruction_ / std::size(devices_);
 
         if (offset == 0)
-            computation_.emplace_back(to_append << offset);
+            computation_.push_back(to_append << offset);
         else
-            computation_.back() |= (to_append << offset);
+            computation_.mutate(std::size(computation_) - 1) |= (to_append << offset);
 
         if (offset + program_->computation_bits() > n_digits)
-            computation_.emplace_back(to_append >> (n_digits - offset));
+            computation_.push_back(to_append >> (n_digits - offset));
+
+        return;
+    }
+
+    void machine_t::computation_append(std::span<const index_t> instructions,
+            index_t repetitions)
+    {
+        static constexpr index_t n_digits = std::numeric_limits<index_t>::digits;
+
+        const index_t bits = program_->computation_bits();
+        index_t offset = computation_size_ % n_digits;
+        index_t word = 0;
+
+        computation_size_ += repetitions * std::size(instructions) * bits;
+
+        if (offset != 0)
+        {
+            word = computation_.back();
+            computation_.pop_back();
+        }
+
+        for (; repetitions != 0; --repetitions)
+            for (index_t to_append : instructions)
+            {
+                word |= to_append << offset;
+                offset += bits;
+
+                if (offset >= n_digits)
+                {
+                    computation_.push_back(word);
+                    offset -= n_digits;
+                    word = offset == 0 ? 0 : to_append >> (bits - offset);
+                }
+            }
+
+        if (offset != 0)
+            computation_.push_back(word);
 
         return;
     }
 
-    device_t::device_t(std::unique_ptr<encoder_t> encoder) noexcept :
+    device_t::device_t(std::shared_ptr<const encoder_t> encoder) noexcept :
         encoder_{std::move(encoder)} {}
 
     const encoder_t &device_t::encoder() const
@@ -3235,9 +4597,74 @@ namespace Machine
         return *encoder_;
     }
 
+    index_t device_t::n_observations() const { return 0; }
+
+    index_t device_t::observation() const { abort("device_t::observation() const"); }
+
+    void device_t::observe(index_t) { abort("device_t::observe(index_t)"); }
+
     void device_t::initialise(const std::string &arg)
         { initialiser().initialise(*this, arg); }
 
+    void device_t::append_configuration(std::vector<index_t> &configuration,
+        const string_t &string)
+    {
+        configuration.emplace_back(std::size(string));
+        configuration.emplace_back(string.pos());
+
+        for (index_t i = 0; i != std::size(string); ++i)
+            configuration.emplace_back(string[i]);
+
+        return;
+    }
+
+    void device_t::append_configuration(std::vector<index_t> &configuration,
+        const unsigned_number_t &number)
+    {
+        configuration.emplace_back(std::size(number.digits()));
+        configuration.insert(std::cend(configuration), std::cbegin(number.digits()),
+            std::cend(number.digits()));
+
+        return;
+    }
+
+    void device_t::extract_configuration(std::span<const index_t> &configuration,
+        string_t &string)
+    {
+        const index_t n = configuration[0];
+        const index_t pos = configuration[1];
+
+        string.clear();
+
+        for (index_t i = 0; i != n; ++i)
+            string.push(configuration[2 + i]);
+
+        string.pos() = pos;
+        configuration = configuration.subspan(2 + n);
+
+        return;
+    }
+
+    void device_t::extract_configuration(std::span<const index_t> &configuration,
+        unsigned_number_t &number)
+    {
+        static constexpr integer_t n_digits = std::numeric_limits<index_t>::digits;
+
+        const index_t n = configuration[0];
+
+        number = 0;
+
+        for (index_t i = n; i != 0; --i)
+        {
+            number <<= n_digits;
+            number += configuration[i];
+        }
+
+        configuration = configuration.subspan(1 + n);
+
+        return;
+    }
+
     bool device_t::terminating() const
         { return terminator().terminating(*this); }
 
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <span>
+#include <array>
+#include <atomic>
 #include <iostream>
 #include <fstream>
 
+#include "cow.hpp"
 #include "encoder.hpp"
 
 namespace Machine
@@ -14,20 +17,92 @@ namespace Machine
     class terminator_t;
     class operation_t;
     class noop_operation_t;
+    class code_t;
+    class unsigned_number_t;
 
     class invalid_operation_t;
     class invalid_terminator_t;
 
     class control_t;
 
+    class code_t
+    {
+    public:
+        enum class opcode_t : unsigned char
+        {
+            noop,
+            control,
+            input_scan, input_next, input_eof,
+            output_write,
+            stack_push, stack_pop, stack_top, stack_empty,
+            queue_enqueue, queue_dequeue, queue_empty,
+            unsigned_counter_inc, unsigned_counter_dec,
+            unsigned_counter_zero, unsigned_counter_non_zero,
+            counter_inc, counter_dec, counter_zero, counter_pos, counter_neg,
+            tape_see, tape_print, tape_move_l, tape_move_r, tape_athome, tape_compound,
+            ram_load, ram_store, ram_add, ram_sub, ram_halve, ram_set_0, ram_set_1,
+            ram_test_gr, ram_test_eq, ram_test_odd, ram_test_even
+        };
+
+        static constexpr index_t compound_athome = 1;
+        static constexpr index_t compound_see = 2;
+        static constexpr index_t compound_print = 4;
+        static constexpr index_t compound_move_l = 8;
+        static constexpr index_t compound_move_r = 16;
+
+    private:
+        opcode_t opcode_;
+        std::array<index_t, 3> arguments_;
+
+    public:
+        code_t() = delete;
+        ~code_t() = default;
+
+        code_t(const code_t &) noexcept = default;
+        code_t &operator=(const code_t &) noexcept = default;
+
+        code_t(code_t &&) noexcept = default;
+        code_t &operator=(code_t &&) noexcept = default;
+
+        code_t(const operation_t &);
+
+    public:
+        opcode_t opcode() const noexcept;
+        index_t argument(index_t) const noexcept;
+
+        bool valid(const device_t &) const;
+        void reserve(device_t &) const;
+        bool applicable(const device_t &) const;
+        index_t repetitions(const device_t &) const;
+        void apply(device_t &) const;
+        void apply(device_t &, index_t) const;
+    };
+
     class machine_t
     {
     private:
         class program_t
         {
+        public:
+            enum class fusion_kind_t { multiply, count };
+
+            struct fusion_t
+            {
+                fusion_kind_t kind_{};
+                index_t device_{0};
+                std::array<index_t, 4> registers_{};
+                std::vector<index_t> instructions_{};
+            };
+
         private:
             std::vector<std::shared_ptr<operation_t>> instruction_set_;
+            std::vector<code_t> code_;
             std::vector<std::vector<std::shared_ptr<operation_t>>::const_iterator> search_table_;
+            std::vector<index_t> dispatch_table_;
+            std::vector<index_t> dispatch_weights_;
+            std::vector<index_t> fusion_table_;
+            std::vector<fusion_t> fusions_;
+            std::vector<std::atomic<index_t>> fired_;
             index_t first_control_;
             index_t computation_bits_;
             bool deterministic_;
@@ -50,10 +125,34 @@ namespace Machine
             decltype(auto) instruction_set(this self_t &&self)
                 { return (std::forward<self_t>(self).instruction_set_); }
 
+            template<class self_t>
+            decltype(auto) code(this self_t &&self)
+                { return (std::forward<self_t>(self).code_); }
+
             template<class self_t>
             decltype(auto) search_table(this self_t &&self)
                 { return (std::forward<self_t>(self).search_table_); }
 
+            template<class self_t>
+            decltype(auto) dispatch_table(this self_t &&self)
+                { return (std::forward<self_t>(self).dispatch_table_); }
+
+            template<class self_t>
+            decltype(auto) dispatch_weights(this self_t &&self)
+                { return (std::forward<self_t>(self).dispatch_weights_); }
+
+            template<class self_t>
+            decltype(auto) fusion_table(this self_t &&self)
+                { return (std::forward<self_t>(self).fusion_table_); }
+
+            template<class self_t>
+            decltype(auto) fusions(this self_t &&self)
+                { return (std::forward<self_t>(self).fusions_); }
+
+            template<class self_t>
+            decltype(auto) fired(this self_t &&self)
+                { return (std::forward<self_t>(self).fired_); }
+
             template<class self_t>
             decltype(auto) first_control(this self_t &&self)
                 { return (std::forward<self_t>(self).first_control_); }
@@ -65,10 +164,15 @@ namespace Machine
             template<class self_t>
             decltype(auto) deterministic(this self_t &&self)
                 { return (std::forward<self_t>(self).deterministic_); }
+
+        private:
+            void compile_dispatch_table(const std::vector<std::unique_ptr<device_t>> &);
+            void compile_fusions(const std::vector<std::unique_ptr<device_t>> &);
         };
 
     public:
         enum class machine_state_t { invalid, running, halted, blocked };
+        static constexpr index_t max_unbounded_steps = index_t{1} << 20;
 
     private:
         std::vector<std::unique_ptr<device_t>> devices_;
@@ -76,7 +180,7 @@ namespace Machine
         std::vector<std::vector<std::shared_ptr<operation_t>>::const_iterator>
             applicable_instructions_{};
         std::vector<std::string> output_;
-        std::vector<index_t> computation_{};
+        Apparatus::cow_vector_t<index_t> computation_{};
         index_t computation_size_{0};
         index_t next_instruction_{negative_1};
         machine_state_t state_{machine_state_t::invalid};
@@ -103,6 +207,7 @@ namespace Machine
         std::vector<std::string> print_instruction(index_t) const;
         std::vector<std::string> print_state() const;
         std::string next_instruction(index_t) const;
+        std::vector<std::string> print_fusions() const;
 
     public:
         const std::vector<std::unique_ptr<device_t>> &devices() const noexcept;
@@ -117,6 +222,7 @@ namespace Machine
         void next();
         void next(index_t);
         void run();
+        index_t advance(index_t);
         std::vector<std::string> print_applicable_instructions() const;
         std::string print_encoder(index_t) const;
         std::string print_initialiser(index_t) const;
@@ -125,18 +231,24 @@ namespace Machine
         index_t selected_instruction() const;
         index_t computation(index_t) const;
         index_t computation_size() const;
+        std::vector<index_t> configuration() const;
+        std::vector<index_t> serialise() const;
+        void deserialise(std::span<const index_t>);
+        index_t footprint() const;
         bool terminating() const;
 
     private:
         void terminate();
+        index_t fuse(index_t, index_t);
         void applicable_instructions_apparatus();
         void computation_append();
+        void computation_append(std::span<const index_t>, index_t);
     };
     
     class device_t
     {
     protected:
-        std::unique_ptr<encoder_t> encoder_;
+        std::shared_ptr<const encoder_t> encoder_;
 
     public:
         device_t() = delete;
@@ -148,7 +260,7 @@ namespace Machine
         device_t(device_t &&) noexcept = default;
         device_t &operator=(device_t &&) noexcept = default;
 
-        device_t(std::unique_ptr<encoder_t>) noexcept;
+        device_t(std::shared_ptr<const encoder_t>) noexcept;
         virtual device_t *clone() const = 0;
 
     public:
@@ -157,11 +269,22 @@ namespace Machine
         virtual const terminator_t &terminator() const = 0;
         virtual std::string print_name() const = 0;
         virtual std::string print_state() const = 0;
+        virtual index_t n_observations() const;
+        virtual index_t observation() const;
+        virtual void observe(index_t);
+        virtual void configuration(std::vector<index_t> &) const = 0;
+        virtual void restore_configuration(std::span<const index_t> &) = 0;
 
         void initialise(const std::string &);
 
         bool terminating() const;
         std::string terminate();
+
+    protected:
+        static void append_configuration(std::vector<index_t> &, const string_t &);
+        static void append_configuration(std::vector<index_t> &, const unsigned_number_t &);
+        static void extract_configuration(std::span<const index_t> &, string_t &);
+        static void extract_configuration(std::span<const index_t> &, unsigned_number_t &);
     };
 
     class operation_t
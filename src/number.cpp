@@ -2,6 +2,8 @@
 
 #include <utility>
 #include <bit>
+#include <algorithm>
+#include <cmath>
 
 namespace Machine
 {
@@ -44,7 +46,7 @@ namespace Machine
         if constexpr (use_assembly)
         {
             asm("sub %2, %0\n\t"
-                "subq $0x0, %1"
+                "sbbq $0x0, %1"
                 : "+rm" (a0), "+rm" (a1)
                 : "r" (b));
 
@@ -224,6 +226,315 @@ namespace Machine
         return {q, r};
     }
 
+    static index_t reciprocal(index_t b)
+    {
+        static constexpr index_t max = std::numeric_limits<index_t>::max();
+
+        return double_word_division(max, max - b, b).front();
+    }
+
+    static index_t reciprocal(index_t b0, index_t b1)
+    {
+        index_t v = reciprocal(b1);
+        index_t p = b1 * v + b0;
+
+        if (p < b0)
+        {
+            --v;
+
+            if (p >= b1)
+            {
+                --v;
+                p -= b1;
+            }
+
+            p -= b1;
+        }
+
+        std::array<index_t, 2> t = double_word_multiplication(v, b0);
+        p += t.back();
+
+        if (p < t.back())
+        {
+            --v;
+
+            if (p > b1 or (p == b1 and t.front() >= b0))
+                --v;
+        }
+
+        return v;
+    }
+
+    static std::array<index_t, 2> reciprocal_division(index_t a0, index_t a1, index_t b,
+        index_t v)
+    {
+        std::array<index_t, 2> q = double_word_multiplication(v, a1);
+        double_word_addition(q.front(), q.back(), a0);
+        q.back() += a1 + 1;
+
+        index_t r = a0 - q.back() * b;
+
+        if (r > q.front())
+        {
+            --q.back();
+            r += b;
+        }
+
+        if (r >= b)
+        {
+            ++q.back();
+            r -= b;
+        }
+
+        return {q.back(), r};
+    }
+
+    static index_t reciprocal_division(index_t a0, index_t a1, index_t a2, index_t b0,
+        index_t b1, index_t v)
+    {
+        std::array<index_t, 2> q = double_word_multiplication(v, a2);
+        double_word_addition(q.front(), q.back(), a1);
+        q.back() += a2;
+
+        index_t r0 = a0;
+        index_t r1 = a1 - b1 * q.back();
+        double_word_subtraction(r0, r1, b0);
+        r1 -= b1;
+
+        std::array<index_t, 2> t = double_word_multiplication(b0, q.back());
+        double_word_subtraction(r0, r1, t.front());
+        r1 -= t.back();
+
+        ++q.back();
+
+        if (r1 >= q.front())
+        {
+            --q.back();
+            double_word_addition(r0, r1, b0);
+            r1 += b1;
+        }
+
+        if (r1 > b1 or (r1 == b1 and r0 >= b0))
+            ++q.back();
+
+        return q.back();
+    }
+
+    // test/number/number_benchmark.cpp times the products and quotients around these thresholds;
+    // they can be overridden at compile time to re-tune them
+#if !defined(MACHINE_KARATSUBA_THRESHOLD)
+#define MACHINE_KARATSUBA_THRESHOLD 32
+#endif
+#if !defined(MACHINE_TOOM_3_THRESHOLD)
+#define MACHINE_TOOM_3_THRESHOLD 384
+#endif
+#if !defined(MACHINE_BURNIKEL_ZIEGLER_THRESHOLD)
+#define MACHINE_BURNIKEL_ZIEGLER_THRESHOLD 128
+#endif
+
+    static constexpr index_t karatsuba_threshold = MACHINE_KARATSUBA_THRESHOLD;
+    static constexpr index_t toom_3_threshold = MACHINE_TOOM_3_THRESHOLD;
+    static constexpr index_t burnikel_ziegler_threshold = MACHINE_BURNIKEL_ZIEGLER_THRESHOLD;
+    static constexpr index_t conversion_threshold = 32;
+
+    static std::array<index_t, 2> chunk(index_t radix)
+    {
+        static constexpr index_t max = std::numeric_limits<index_t>::max();
+        std::array<index_t, 2> ret{1, radix};
+
+        while (ret.back() <= max / radix / radix)
+        {
+            ret.back() *= radix;
+            ++ret.front();
+        }
+
+        return ret;
+    }
+
+    static bool add_words(index_t *r, const index_t *a, index_t na, const index_t *b, index_t nb)
+    {
+        bool carry = false;
+        index_t i = 0;
+
+        for (; i != nb; ++i)
+        {
+            index_t c = a[i] + b[i];
+            bool next_carry = c < b[i];
+
+            if (carry)
+            {
+                ++c;
+                next_carry = next_carry or (c == 0);
+            }
+
+            r[i] = c;
+            carry = next_carry;
+        }
+
+        for (; i != na; ++i)
+        {
+            r[i] = a[i] + carry;
+            carry = carry and r[i] == 0;
+        }
+
+        return carry;
+    }
+
+    static bool subtract_words(index_t *r, const index_t *a, index_t na, const index_t *b,
+        index_t nb)
+    {
+        bool borrow = false;
+        index_t i = 0;
+
+        for (; i != nb; ++i)
+        {
+            index_t c = a[i] - b[i];
+            bool next_borrow = a[i] < b[i];
+
+            if (borrow)
+            {
+                next_borrow = next_borrow or (c == 0);
+                --c;
+            }
+
+            r[i] = c;
+            borrow = next_borrow;
+        }
+
+        for (; i != na; ++i)
+        {
+            r[i] = a[i] - borrow;
+            borrow = borrow and r[i] == std::numeric_limits<index_t>::max();
+        }
+
+        return borrow;
+    }
+
+    static index_t shift_left_words(index_t *r, const index_t *a, index_t n, index_t bits)
+    {
+        static constexpr index_t n_digits = std::numeric_limits<index_t>::digits;
+
+        const index_t ret = a[n - 1] >> (n_digits - bits);
+
+        for (index_t i = n - 1; i != 0; --i)
+            r[i] = (a[i] << bits) | (a[i - 1] >> (n_digits - bits));
+
+        r[0] = a[0] << bits;
+
+        return ret;
+    }
+
+    static void shift_right_words(index_t *r, const index_t *a, index_t n, index_t bits)
+    {
+        static constexpr index_t n_digits = std::numeric_limits<index_t>::digits;
+
+        for (index_t i = 0; i != n - 1; ++i)
+            r[i] = (a[i] >> bits) | (a[i + 1] << (n_digits - bits));
+
+        r[n - 1] = a[n - 1] >> bits;
+
+        return;
+    }
+
+    static bool multiply_subtract(index_t *r, const index_t *a, index_t n, index_t q)
+    {
+        index_t carry = 0;
+        bool borrow = false;
+
+        for (index_t i = 0; i != n; ++i)
+        {
+            std::array<index_t, 2> c = double_word_multiplication(q, a[i]);
+            double_word_addition(c.front(), c.back(), carry);
+            double_word_addition(c.front(), c.back(), borrow);
+            carry = c.back();
+
+            borrow = r[i] < c.front();
+            r[i] -= c.front();
+        }
+
+        return borrow or carry != 0;
+    }
+
+    static bool absolute_difference(index_t *r, const index_t *a, index_t na, const index_t *b,
+        index_t nb)
+    {
+        bool swapped = std::all_of(a + nb, a + na, [](index_t i) { return i == 0; });
+
+        if (swapped)
+            for (index_t i = nb; i-- != 0;)
+                if (a[i] != b[i])
+                {
+                    swapped = a[i] < b[i];
+                    break;
+                }
+
+        if (swapped)
+        {
+            subtract_words(r, b, nb, a, nb);
+            std::fill(r + nb, r + na, 0);
+        }
+        else
+            subtract_words(r, a, na, b, nb);
+
+        return swapped;
+    }
+
+    static void schoolbook_multiplication(const index_t *a, index_t na, const index_t *b,
+        index_t nb, index_t *r)
+    {
+        std::fill(r, r + na + nb, 0);
+
+        for (index_t i = 0; i != na; ++i)
+        {
+            index_t carry = 0;
+            for (index_t j = 0; j != nb; ++j)
+            {
+                std::array<index_t, 2> c = double_word_multiplication(a[i], b[j]);
+                double_word_addition(c.front(), c.back(), r[i + j]);
+                double_word_addition(c.front(), c.back(), carry);
+                
+                r[i + j] = c.front();
+                carry = c.back();
+            }
+            r[i + nb] = carry;
+        }
+
+        return;
+    }
+
+    static void karatsuba_multiplication(const index_t *a, const index_t *b, index_t n,
+        index_t *r, index_t *t)
+    {
+        if (n < karatsuba_threshold)
+            return schoolbook_multiplication(a, n, b, n, r);
+
+        const index_t m = (n + 1) / 2;
+        const index_t h = n - m;
+
+        index_t *da = t;
+        index_t *db = t + m;
+        index_t *p = t + 2 * m;
+        index_t *w = t + 4 * m;
+
+        bool negative = absolute_difference(da, a, m, a + m, h) !=
+            absolute_difference(db, b, m, b + m, h);
+
+        karatsuba_multiplication(a, b, m, r, w);
+        karatsuba_multiplication(a + m, b + m, h, r + 2 * m, w);
+        karatsuba_multiplication(da, db, m, p, w);
+
+        w[2 * m] = add_words(w, r, 2 * m, r + 2 * m, 2 * h);
+
+        if (negative)
+            add_words(w, w, 2 * m + 1, p, 2 * m);
+        else
+            subtract_words(w, w, 2 * m + 1, p, 2 * m);
+
+        add_words(r + m, r + m, 2 * n - m, w, std::min(2 * m + 1, 2 * n - m));
+
+        return;
+    }
+
     unsigned_number_t::unsigned_number_t(index_t num)
     {
         if (num != 0)
@@ -244,23 +555,26 @@ namespace Machine
                 "(Apparatus::string_iterator_template_t<stride, is_const>, "
                 "Apparatus::string_iterator_template_t<stride, is_const>, const encoder_t &):\n"};
 
+        std::vector<index_t> digits;
+        index_t radix;
+
         if (typeid(encoder) == typeid(encoder_b_ary_t))
         {
-            const index_t radix = encoder.alphabet().max_character() + 1;
+            radix = encoder.alphabet().max_character() + 1;
 
             for (; begin != end; ++begin)
-                *this = *this * radix + *begin;
+                digits.push_back(*begin);
         }
         else if (typeid(encoder) == typeid(encoder_b_adic_t))
         {
-            const index_t radix = encoder.alphabet().max_character() + 1;
+            radix = encoder.alphabet().max_character() + 1;
 
             for (; begin != end; ++begin)
-                *this = *this * radix + *begin + static_cast<character_t>(1);
+                digits.push_back(*begin + 1);
         }
         else if (typeid(encoder) == typeid(encoder_signed_b_ary_t))
         {
-            const index_t radix = encoder.alphabet().max_character() - 1;
+            radix = encoder.alphabet().max_character() - 1;
 
             if (*begin == radix)
                 ++begin;
@@ -269,12 +583,12 @@ namespace Machine
             {
                 if (*begin >= radix)
                     throw std::runtime_error{error + "Unexpected sign character.\n"};
-                *this = *this * radix + *begin;
+                digits.push_back(*begin);
             }
         }
         else if (typeid(encoder) == typeid(encoder_signed_b_adic_t))
         {
-            const index_t radix = encoder.alphabet().max_character() - 1;
+            radix = encoder.alphabet().max_character() - 1;
 
             if (*begin == radix)
                 ++begin;
@@ -283,13 +597,15 @@ namespace Machine
             {
                 if (*begin >= radix)
                     throw std::runtime_error{error + "Unexpected sign character.\n"};
-                *this = *this * radix + *begin + static_cast<character_t>(1);
+                digits.push_back(*begin + 1);
             }
         }
         else
             throw std::runtime_error{error + "Unknown encoder type.\n"};
 
-        return;        
+        *this = from_digits(digits, radix);
+
+        return;
     }
 
     unsigned_number_t::unsigned_number_t(std::string_view string, const encoder_t &encoder)
@@ -297,23 +613,28 @@ namespace Machine
         static const std::string error{"In Machine::unsigned_number_t::unsigned_number_t"
                 "(std::string_view, const encoder_t &):\n"};
 
+        std::vector<index_t> digits;
+        index_t radix;
+
+        digits.reserve(std::size(string));
+
         if (typeid(encoder) == typeid(encoder_b_ary_t))
         {
-            const index_t radix = encoder.alphabet().max_character() + 1;
+            radix = encoder.alphabet().max_character() + 1;
 
             for (char c : string)
-                *this = *this * radix + encoder(c);
+                digits.push_back(encoder(c));
         }
         else if (typeid(encoder) == typeid(encoder_b_adic_t))
         {
-            const index_t radix = encoder.alphabet().max_character() + 1;
+            radix = encoder.alphabet().max_character() + 1;
 
             for (char c : string)
-                *this = *this * radix + encoder(c) + static_cast<character_t>(1);
+                digits.push_back(encoder(c) + 1);
         }
         else if (typeid(encoder) == typeid(encoder_signed_b_ary_t))
         {
-            const index_t radix = encoder.alphabet().max_character() - 1;
+            radix = encoder.alphabet().max_character() - 1;
 
             if (string.front() == '+')
                 string.remove_prefix(1);
@@ -325,12 +646,12 @@ namespace Machine
                 if (d >= radix)
                     throw std::runtime_error{error + "Unexpected sign character.\n"};
 
-                *this = *this * radix + d;
+                digits.push_back(d);
             }
         }
         else if (typeid(encoder) == typeid(encoder_signed_b_adic_t))
         {
-            const index_t radix = encoder.alphabet().max_character() - 1;
+            radix = encoder.alphabet().max_character() - 1;
 
             if (string.front() == '+')
                 string.remove_prefix(1);
@@ -342,58 +663,73 @@ namespace Machine
                 if (d >= radix)
                     throw std::runtime_error{error + "Unexpected sign character.\n"};
 
-                *this = *this * radix + d + static_cast<character_t>(1);
+                digits.push_back(d + 1);
             }
         }
         else
             throw std::runtime_error{error + "Unknown encoder type.\n"};
 
-        return;        
+        *this = from_digits(digits, radix);
+
+        return;
     }
 
     void unsigned_number_t::swap(unsigned_number_t &arg) noexcept { digits_.swap(arg.digits_); }
 
-    const std::vector<index_t> &unsigned_number_t::digits() const noexcept { return digits_; }
+    const unsigned_number_t::digits_t &unsigned_number_t::digits() const noexcept
+        { return digits_; }
 
     bool unsigned_number_t::zero() const noexcept { return std::empty(digits_); }
 
-    string_t unsigned_number_t::b_ary(character_t radix) const
+    bool unsigned_number_t::odd() const noexcept
+        { return not zero() and (digits_.front() & 1) != 0; }
+
+    string_t unsigned_number_t::b_ary(character_t radix) const { return convert(radix, negative_1); }
+
+    string_t unsigned_number_t::b_adic(character_t radix) const
     {
-        string_t ret{radix};
+        if (zero())
+            return string_t{radix};
 
-        for (unsigned_number_t a = *this; not a.zero();)
+        if (radix == 1)
         {
-            std::array<unsigned_number_t, 2> b = divide(std::move(a), radix);
-            unsigned_number_t &r = b.back();
-            a = b.front();
-            if (r.zero())
+            string_t ret{radix};
+
+            for (unsigned_number_t a = *this; not a.zero(); --a)
                 ret.push(0);
-            else
-                ret.push(static_cast<character_t>(r.digits().front()));
+
+            return ret;
         }
 
-        return ret;
-    }
+        unsigned_number_t x = *this * (radix - 1) + 1;
+        index_t length = static_cast<index_t>(
+            static_cast<double>(std::size(x.digits_) * n_digits -
+                std::countl_zero(x.digits_.back())) / std::log2(static_cast<double>(radix)));
 
-    string_t unsigned_number_t::b_adic(character_t radix) const
-    {
-        string_t ret{radix};
+        unsigned_number_t power = 1;
+        unsigned_number_t a = radix;
 
-        for (unsigned_number_t a = *this; not a.zero();)
+        for (index_t i = length; i != 0; i >>= 1)
         {
-            std::array<unsigned_number_t, 2> b = divide(std::move(a), radix);
-            unsigned_number_t &r = b.back();
-            a = b.front();
-            if (r.zero())
-            {
-                ret.push(radix - 1);
-                --a;
-            }
-            else
-                ret.push(static_cast<character_t>(r.digits().front() - 1));
+            if (i & 1)
+                power *= a;
+            if (i > 1)
+                a = a * a;
         }
 
-        return ret;
+        while (power > x)
+        {
+            power /= radix;
+            --length;
+        }
+
+        while (power * radix <= x)
+        {
+            power *= radix;
+            ++length;
+        }
+
+        return (*this - (power - 1) / (radix - 1)).convert(radix, length);
     }
 
     std::string unsigned_number_t::print_b_ary(character_t radix) const
@@ -427,30 +763,241 @@ namespace Machine
                 "Unknown encoder type.\n"};
     }
 
-    index_t unsigned_number_t::load_half_word(index_t index) const
-        { return (digits_[index / 2] & mask[index % 2]) >> (n_digits_half * (index % 2)); }
+    void unsigned_number_t::normalise()
+    {
+        while (not std::empty(digits_) and digits_.back() == 0)
+            digits_.pop_back();
+        return;
+    }
+
+    unsigned_number_t unsigned_number_t::slice(index_t begin, index_t end) const
+    {
+        unsigned_number_t ret{};
+        end = std::min(end, std::size(digits_));
+
+        if (begin < end)
+            ret.digits_.assign(std::cbegin(digits_) + begin, std::cbegin(digits_) + end);
+
+        ret.normalise();
+
+        return ret;
+    }
 
-    void unsigned_number_t::store_half_word(index_t index, index_t arg)
+    void unsigned_number_t::add_shifted(const unsigned_number_t &arg, index_t shift)
     {
-        digits_[index / 2] &= mask[(index + 1) % 2];
-        digits_[index / 2] |= (arg << (n_digits_half * (index % 2)));
+        const digits_t &v = arg.digits_;
+
+        if (std::empty(v))
+            return;
+
+        if (std::size(digits_) < shift + std::size(v))
+            digits_.resize(shift + std::size(v), 0);
+
+        auto i = std::begin(digits_) + shift;
+        bool carry = false;
+
+        for (auto j = std::cbegin(v); j != std::cend(v); ++i, ++j)
+        {
+            *i += *j;
+            bool next_carry = *i < *j;
+
+            if (carry)
+            {
+                ++*i;
+                next_carry = next_carry or (*i == 0);
+            }
+
+            carry = next_carry;
+        }
+
+        for (; carry and i != std::end(digits_); ++i)
+        {
+            ++*i;
+            carry = (*i == 0);
+        }
+
+        if (carry)
+            digits_.push_back(1);
+
         return;
     }
 
-    void unsigned_number_t::normalise()
+    void unsigned_number_t::multiply_add(index_t mul, index_t add)
     {
-        while (not std::empty(digits_) and digits_.back() == 0)
-            digits_.pop_back();
+        for (index_t &i : digits_)
+        {
+            std::array<index_t, 2> c = double_word_multiplication(i, mul);
+            double_word_addition(c.front(), c.back(), add);
+            i = c.front();
+            add = c.back();
+        }
+
+        if (add != 0)
+            digits_.push_back(add);
+
         return;
     }
 
+    index_t unsigned_number_t::divide_word(index_t arg)
+    {
+        index_t r = 0;
+
+        for (auto i = std::rbegin(digits_); i != std::rend(digits_); ++i)
+        {
+            std::array<index_t, 2> d = double_word_division(*i, r, arg);
+            *i = d.front();
+            r = d.back();
+        }
+
+        normalise();
+
+        return r;
+    }
+
+    string_t unsigned_number_t::convert(character_t radix, index_t length) const
+    {
+        if (radix < 2)
+            throw std::runtime_error{"In Machine::unsigned_number_t::convert(character_t, "
+                "index_t) const:\nInvalid radix.\n"};
+
+        const auto [k, power] = chunk(radix);
+        string_t ret{radix};
+
+        std::vector<unsigned_number_t> powers{power};
+        while (powers.back() <= *this)
+            powers.push_back(powers.back() * powers.back());
+
+        auto emit = [&] (const auto &self, unsigned_number_t x, index_t level, index_t n) -> void
+        {
+            if (level == 0 or std::size(x.digits_) <= conversion_threshold)
+            {
+                for (index_t produced = 0; not x.zero() or (n != negative_1 and produced < n);)
+                {
+                    index_t c = x.divide_word(power);
+
+                    for (index_t j = 0; j != k and produced != n; ++j, ++produced)
+                    {
+                        if (n == negative_1 and x.zero() and c == 0)
+                            break;
+
+                        ret.push(static_cast<character_t>(c % radix));
+                        c /= radix;
+                    }
+                }
+
+                return;
+            }
+
+            const index_t low = k << (level - 1);
+
+            if (n == negative_1 ? x < powers[level - 1] : n <= low)
+                return self(self, std::move(x), level - 1, n);
+
+            auto [q, r] = divide(std::move(x), powers[level - 1]);
+
+            self(self, std::move(r), level - 1, low);
+
+            if (n != negative_1)
+                self(self, std::move(q), level - 1, n - low);
+            else if (not q.zero())
+                self(self, std::move(q), level - 1, negative_1);
+
+            return;
+        };
+
+        emit(emit, *this, std::size(powers) - 1, length);
+
+        return ret;
+    }
+
+    unsigned_number_t unsigned_number_t::from_digits(const std::vector<index_t> &digits,
+        index_t radix)
+    {
+        const auto [k, power] = chunk(radix);
+        std::vector<index_t> chunks((std::size(digits) + k - 1) / k, 0);
+
+        for (index_t i = 0, j = std::size(chunks) * k - std::size(digits); i != std::size(digits);
+                ++i, ++j)
+            chunks[std::size(chunks) - 1 - j / k] =
+                chunks[std::size(chunks) - 1 - j / k] * radix + digits[i];
+
+        std::vector<unsigned_number_t> powers{power};
+        while ((index_t{1} << std::size(powers)) < std::size(chunks))
+            powers.push_back(powers.back() * powers.back());
+
+        auto combine = [&] (const auto &self, index_t begin, index_t n) -> unsigned_number_t
+        {
+            unsigned_number_t ret{};
+
+            if (n <= conversion_threshold)
+            {
+                for (index_t i = begin + n; i-- != begin;)
+                    ret.multiply_add(power, chunks[i]);
+
+                return ret;
+            }
+
+            const index_t level = std::bit_width(n - 1) - 1;
+            const index_t low = index_t{1} << level;
+
+            ret = self(self, begin + low, n - low) * powers[level];
+            ret += self(self, begin, low);
+
+            return ret;
+        };
+
+        return combine(combine, 0, std::size(chunks));
+    }
+
+    unsigned_number_t unsigned_number_t::toom_3(const unsigned_number_t &a,
+        const unsigned_number_t &b)
+    {
+        const index_t k = (std::size(a.digits_) + 2) / 3;
+
+        auto evaluate = [k] (const unsigned_number_t &arg) -> std::array<signed_number_t, 5>
+        {
+            signed_number_t c0 = arg.slice(0, k);
+            signed_number_t c1 = arg.slice(k, 2 * k);
+            signed_number_t c2 = arg.slice(2 * k, std::size(arg.digits_));
+
+            signed_number_t t = c0 + c2;
+            signed_number_t p1 = t + c1;
+            signed_number_t pm1 = t - c1;
+            signed_number_t pm2 = ((pm1 + c2) << 1) - c0;
+
+            return {std::move(c0), std::move(p1), std::move(pm1), std::move(pm2), std::move(c2)};
+        };
+
+        std::array<signed_number_t, 5> p = evaluate(a);
+        std::array<signed_number_t, 5> q = evaluate(b);
+        std::array<signed_number_t, 5> r;
+
+        for (index_t i = 0; i != 5; ++i)
+            r[i] = p[i] * q[i];
+
+        signed_number_t r3 = (r[3] - r[1]) / 3;
+        signed_number_t r1 = (r[1] - r[2]) >> 1;
+        signed_number_t r2 = r[2] - r[0];
+        r3 = ((r2 - r3) >> 1) + (r[4] << 1);
+        r2 += r1 - r[4];
+        r1 -= r3;
+
+        unsigned_number_t ret = std::move(r[0]).abs();
+        ret.add_shifted(r1.abs(), k);
+        ret.add_shifted(r2.abs(), 2 * k);
+        ret.add_shifted(r3.abs(), 3 * k);
+        ret.add_shifted(r[4].abs(), 4 * k);
+
+        return ret;
+    }
+
     std::strong_ordering unsigned_number_t::operator<=>(const unsigned_number_t &arg) const
     {
         if (std::size(digits_) != std::size(arg.digits_))
             return std::size(digits_) <=> std::size(arg.digits_);
 
-        for (auto i = std::crbegin(digits_), j = std::crbegin(arg.digits_); i != crend(digits_);
-                ++i, ++j)
+        for (auto i = std::crbegin(digits_), j = std::crbegin(arg.digits_);
+                i != std::crend(digits_); ++i, ++j)
             if (*i != *j)
                 return *i <=> *j;
 
@@ -588,7 +1135,7 @@ namespace Machine
 
         index_t new_size = std::size(digits_);
 
-        for (auto i = std::crbegin(digits_); *i == 0 and i != std::crend(digits_); ++i)
+        for (auto i = std::crbegin(digits_); i != std::crend(digits_) and *i == 0; ++i)
             --new_size;
 
         digits_.resize(new_size);
@@ -622,31 +1169,21 @@ namespace Machine
         if (zero())
             return *this;
 
-        if (b != 0)
-        {
-            const index_t mask = max << (n_digits - b);
-
-            index_t c = 0;
+        const index_t n = std::size(digits_);
+        digits_.resize(n + a + (b != 0));
+        index_t *data = std::data(digits_);
 
-            for (auto &i : digits_)
-            {
-                index_t d = (i & mask) >> (n_digits - b);
-                i <<= b;
-                i |= c;
-                c = d;
-            }
+        if (b == 0)
+            std::copy_backward(data, data + n, data + n + a);
+        else
+        {
+            data[n + a] = shift_left_words(data + a, data, n, b);
 
-            if (c != 0)
-                digits_.emplace_back(c);
+            if (data[n + a] == 0)
+                digits_.pop_back();
         }
 
-        digits_.resize(std::size(digits_) + a);
-        
-        auto i = std::rbegin(digits_);
-        for (auto  j = std::rbegin(digits_) + a; j != std::rend(digits_); ++i, ++j)
-            *i = *j;
-        for (; i != std::rend(digits_); ++i)
-            *i = 0;
+        std::fill(data, data + a, 0);
 
         return *this;
     }
@@ -665,26 +1202,18 @@ namespace Machine
             return *this;
         }
 
-        else
-            digits_.erase(std::begin(digits_), std::begin(digits_) + a);
+        const index_t n = std::size(digits_) - a;
+        index_t *data = std::data(digits_);
 
-        if (b != 0)
-        {
-            const index_t mask = max >> (n_digits - b);
+        if (b == 0)
+            std::copy(data + a, data + a + n, data);
+        else
+            shift_right_words(data, data + a, n, b);
 
-            index_t c = 0;
+        digits_.resize(n);
 
-            for (auto i = std::rbegin(digits_); i != std::rend(digits_); ++i)
-            {
-                index_t d = (*i & mask) << (n_digits - b);
-                *i >>= b;
-                *i |= c;
-                c = d;
-            }
-
-            if (digits_.back() == 0)
-                digits_.pop_back();
-        }
+        if (digits_.back() == 0)
+            digits_.pop_back();
 
         return *this;
     }
@@ -697,27 +1226,37 @@ namespace Machine
 
     unsigned_number_t operator*(const unsigned_number_t &a, const unsigned_number_t &b)
     {
+        const index_t sa = std::size(a.digits_);
+        const index_t sb = std::size(b.digits_);
+
+        if (sa < sb)
+            return b * a;
+
         unsigned_number_t ret{};
-        const std::vector<index_t> &va = a.digits_;
-        const std::vector<index_t> &vb = b.digits_;
-        std::vector<index_t> &vr = ret.digits_;
-        index_t sa = std::size(va);
-        index_t sb = std::size(vb);
-        ret.digits_.resize(sa + sb, 0);
 
-        for (index_t i = 0; i != sa; ++i)
+        if (sb < karatsuba_threshold)
         {
-            index_t carry = 0;
-            for (index_t j = 0; j != sb; ++j)
-            {
-                std::array<index_t, 2> c = double_word_multiplication(va[i], vb[j]);
-                double_word_addition(c.front(), c.back(), vr[i + j]);
-                double_word_addition(c.front(), c.back(), carry);
-                
-                vr[i + j] = c.front();
-                carry = c.back();
-            }
-            vr[i + sb] = carry;
+            ret.digits_.resize(sa + sb);
+            schoolbook_multiplication(std::data(a.digits_), sa, std::data(b.digits_), sb,
+                std::data(ret.digits_));
+        }
+
+        else if (sa >= 2 * sb)
+            for (index_t i = 0; i < sa; i += sb)
+                ret.add_shifted(a.slice(i, i + sb) * b, i);
+
+        else if (sb >= toom_3_threshold)
+            return unsigned_number_t::toom_3(a, b);
+
+        else
+        {
+            unsigned_number_t::digits_t vb{b.digits_};
+            std::vector<index_t> t(8 * sa + 64);
+
+            vb.resize(sa, 0);
+            ret.digits_.resize(2 * sa);
+            karatsuba_multiplication(std::data(a.digits_), std::data(vb), sa,
+                std::data(ret.digits_), std::data(t));
         }
 
         ret.normalise();
@@ -752,27 +1291,33 @@ namespace Machine
         if (a.zero())
             return {};
 
-        std::vector<index_t> &va = a.digits_;
-        index_t sa = std::size(va);
+        static constexpr index_t n_digits = unsigned_number_t::n_digits;
+
+        const index_t d = std::countl_zero(b);
+        b <<= d;
+        const index_t v = reciprocal(b);
 
-        index_t r = 0;
-        for (index_t i = sa - 1; i != negative_1; --i)
+        unsigned_number_t::digits_t &va = a.digits_;
+        index_t r = d == 0 ? 0 : va.back() >> (n_digits - d);
+
+        for (index_t i = std::size(va) - 1; i != negative_1; --i)
         {
-            index_t c = va[i];
-            std::array<index_t, 2> d = double_word_division(c, r, b);
+            index_t c = va[i] << d;
+            if (d != 0 and i != 0)
+                c |= va[i - 1] >> (n_digits - d);
 
-            va[i] = d.front();
-            r = d.back();
+            std::array<index_t, 2> e = reciprocal_division(c, r, b, v);
+            va[i] = e.front();
+            r = e.back();
         }
 
         a.normalise();
 
-        return {a, r};
+        return {std::move(a), r >> d};
     }
 
     std::array<unsigned_number_t, 2> divide(unsigned_number_t a, unsigned_number_t b)
     {
-        static constexpr index_t max = unsigned_number_t::max;
         static constexpr index_t n_digits = unsigned_number_t::n_digits;
 
         if (b.zero())
@@ -785,11 +1330,102 @@ namespace Machine
         if (a < b)
             return {0, std::move(a)};
 
+        const index_t sb = std::size(b.digits_);
+
+        if (sb == 1)
+            return divide(std::move(a), b.digits().front());
+
+        if (sb < burnikel_ziegler_threshold or
+                std::size(a.digits_) - sb < burnikel_ziegler_threshold)
+            return unsigned_number_t::long_division(std::move(a), std::move(b));
+
+        index_t n = sb;
+        index_t levels = 0;
+        for (; n >= burnikel_ziegler_threshold; n = (n + 1) / 2)
+            ++levels;
+        n <<= levels;
+
+        const integer_t shift = (n - sb) * n_digits + std::countl_zero(b.digits_.back());
+        a <<= shift;
+        b <<= shift;
+
+        const index_t blocks = std::size(a.digits_) / n + 1;
+        std::array<unsigned_number_t, 2> ret{};
+        unsigned_number_t &r = ret.back();
+
+        for (index_t i = blocks; i-- != 0;)
+        {
+            r <<= n * n_digits;
+            r += a.slice(i * n, (i + 1) * n);
+
+            std::array<unsigned_number_t, 2> c = unsigned_number_t::divide_2_1(r, b, n);
+            ret.front().add_shifted(c.front(), i * n);
+            r = std::move(c.back());
+        }
+
+        r >>= shift;
+
+        return ret;
+    }
+
+    std::array<unsigned_number_t, 2> unsigned_number_t::divide_2_1(const unsigned_number_t &a,
+        const unsigned_number_t &b, index_t n)
+    {
+        if (n % 2 != 0 or n < burnikel_ziegler_threshold)
+            return long_division(a, b);
+
+        const index_t h = n / 2;
+
+        std::array<unsigned_number_t, 2> c = divide_3_2(a.slice(h, 4 * h), b, h);
+        c.back() <<= h * n_digits;
+        c.back() += a.slice(0, h);
+
+        std::array<unsigned_number_t, 2> d = divide_3_2(c.back(), b, h);
+        d.front().add_shifted(c.front(), h);
+
+        return d;
+    }
+
+    std::array<unsigned_number_t, 2> unsigned_number_t::divide_3_2(const unsigned_number_t &a,
+        const unsigned_number_t &b, index_t h)
+    {
+        unsigned_number_t a1 = a.slice(2 * h, 3 * h);
+        unsigned_number_t b1 = b.slice(h, 2 * h);
+        std::array<unsigned_number_t, 2> c;
+
+        if (a1 < b1)
+            c = divide_2_1(a.slice(h, 3 * h), b1, h);
+        else
+        {
+            c.front().digits_.assign(h, max);
+            c.back() = a.slice(h, 2 * h) + b1;
+        }
+
+        signed_number_t r = (c.back() << (h * n_digits)) + a.slice(0, h);
+        r -= c.front() * b.slice(0, h);
+
+        while (r.neg())
+        {
+            --c.front();
+            r += b;
+        }
+
+        c.back() = std::move(r).abs();
+
+        return c;
+    }
+
+    std::array<unsigned_number_t, 2> unsigned_number_t::long_division(unsigned_number_t a,
+        unsigned_number_t b)
+    {
+        if (a < b)
+            return {0, std::move(a)};
+
         if (std::size(b.digits()) == 1)
             return divide(std::move(a), b.digits().front());
 
-        std::vector<index_t> &va = a.digits_;
-        std::vector<index_t> &vb = b.digits_;
+        digits_t &va = a.digits_;
+        digits_t &vb = b.digits_;
 
         std::array<unsigned_number_t, 2> ret{};
         index_t d, sa, sb;
@@ -803,7 +1439,7 @@ namespace Machine
             b.digits_.push_back(0);
 
             sa = std::size(va);
-            if (sa <= sb or va.back() >= vb.back())
+            if (sa <= sb or va.back() >= vb[sb - 1])
             {
                 va.push_back(0);
                 ++sa;
@@ -814,73 +1450,21 @@ namespace Machine
 
         const index_t v1 = vb[sb - 1];
         const index_t v2 = vb[sb - 2];
+        const index_t v = reciprocal(v2, v1);
 
         for (index_t i = sa - sb - 1; i != negative_1; --i)
         {
-            index_t q;
-            {
-                index_t n0 = va[i + sb];
-                index_t n1 = va[i + sb - 1];
-                index_t n2 = va[i + sb - 2];
-
-                bool overflow_r;
-                index_t r;
-                if (n0 == v1)
-                {
-                    q = max;
-                    r = n1 + v1;
-                    overflow_r = r < v1;
-                }
-                else
-                {
-                    std::array<index_t, 2> c = double_word_division(n1, n0, v1);
-                    q = c.front();
-                    r = c.back();
-                    overflow_r = false;
-                }
+            const index_t n0 = va[i + sb];
+            const index_t n1 = va[i + sb - 1];
 
-                std::array<index_t, 2> mul = double_word_multiplication(v2, q);
-                while (not overflow_r and
-                        (mul.back() > r or (mul.back() == r and mul.front() > n2)))
-                {
-                    --q;
-                    double_word_subtraction(mul.front(), mul.back(), v2);
-                    r += v1;
-                    overflow_r = r < v1;
-                }
-            }
+            index_t q = max;
+            if (n0 != v1 or n1 != v2)
+                q = reciprocal_division(va[i + sb - 2], n1, n0, v2, v1, v);
 
-            if (q != 0)
+            if (q != 0 and multiply_subtract(std::data(va) + i, std::data(vb), sb + 1, q))
             {
-                index_t mul_carry = 0;
-                index_t sub_carry = 0;
-                for (index_t j = 0; j != sb + 1; ++j)
-                {
-                    std::array<index_t, 2> t = double_word_multiplication(q, vb[j]);
-                    double_word_addition(t.front(), t.back(), mul_carry);
-                    mul_carry = t.back();
-                    
-                    va[i + j] -= sub_carry;
-                    sub_carry = sub_carry and va[i + j] == max;
-
-                    sub_carry = va[i + j] < t.front();
-                    va[i + j] -= t.front();
-                }
-
-                if (sub_carry)
-                {
-                    --q;
-
-                    index_t carry = 0;
-                    for (index_t j = 0; j != sb + 1; ++j)
-                    {
-                        va[i + j] += carry;
-                        carry = carry and va[i + j] == 0;
-
-                        va[i + j] += vb[j];
-                        carry += va[i + j] < vb[j];
-                    }
-                }
+                --q;
+                add_words(std::data(va) + i, std::data(va) + i, sb + 1, std::data(vb), sb + 1);
             }
 
             ret.front().digits_[i] = q;
@@ -1,6 +1,7 @@
 #pragma once
 #include "encoder.hpp"
 #include "hash.hpp"
+#include "small_vector.hpp"
 
 #include <array>
 
@@ -18,6 +19,9 @@ namespace Machine
         friend std::array<unsigned_number_t, 2> divide(unsigned_number_t a, unsigned_number_t b);
         friend class signed_number_t;
 
+    public:
+        using digits_t = Apparatus::small_vector_t<index_t>;
+
     private:
         static constexpr index_t n_digits = std::numeric_limits<index_t>::digits;
         static constexpr index_t n_digits_half = n_digits / 2;
@@ -26,10 +30,10 @@ namespace Machine
         static constexpr std::array<index_t, 2> mask{max >> (n_digits / 2), max << (n_digits / 2)};
         static constexpr index_t max_half = mask.front();
 
-        std::vector<index_t> digits_{};
+        digits_t digits_{};
 
     public:
-        unsigned_number_t() noexcept(noexcept(std::vector<index_t>())) = default;
+        unsigned_number_t() noexcept = default;
         ~unsigned_number_t() = default;
 
         unsigned_number_t(const unsigned_number_t &) = default;
@@ -50,8 +54,9 @@ namespace Machine
         void swap(unsigned_number_t &) noexcept;
 
     public:
-        const std::vector<index_t> &digits() const noexcept;
+        const digits_t &digits() const noexcept;
         bool zero() const noexcept;
+        bool odd() const noexcept;
 
         string_t b_ary(character_t) const;
         string_t b_adic(character_t) const;
@@ -61,9 +66,21 @@ namespace Machine
         std::string print(const encoder_t &) const;
 
     private:
-        index_t load_half_word(index_t) const;
-        void store_half_word(index_t, index_t);
         void normalise();
+        unsigned_number_t slice(index_t, index_t) const;
+        void add_shifted(const unsigned_number_t &, index_t);
+        void multiply_add(index_t, index_t);
+        index_t divide_word(index_t);
+        string_t convert(character_t, index_t) const;
+
+        static unsigned_number_t from_digits(const std::vector<index_t> &, index_t);
+        static unsigned_number_t toom_3(const unsigned_number_t &, const unsigned_number_t &);
+        static std::array<unsigned_number_t, 2> long_division(unsigned_number_t,
+            unsigned_number_t);
+        static std::array<unsigned_number_t, 2> divide_2_1(const unsigned_number_t &,
+            const unsigned_number_t &, index_t);
+        static std::array<unsigned_number_t, 2> divide_3_2(const unsigned_number_t &,
+            const unsigned_number_t &, index_t);
 
     public:
         bool operator==(const unsigned_number_t &) const = default;
@@ -112,7 +129,7 @@ namespace Machine
         unsigned_number_t magnitude_{};
 
     public:
-        signed_number_t() noexcept(noexcept(std::vector<index_t>())) = default;
+        signed_number_t() noexcept = default;
         ~signed_number_t() = default;
 
         signed_number_t(const signed_number_t &) = default;
@@ -188,7 +205,7 @@ class std::hash<Machine::unsigned_number_t>
 {
 public:
     std::size_t operator()(const Machine::unsigned_number_t &arg) const
-        { return std::hash<std::vector<Machine::index_t>>{}(arg.digits()); }
+        { return std::hash<Machine::unsigned_number_t::digits_t>{}(arg.digits()); }
 };
 
 template<>
@@ -196,6 +213,6 @@ class std::hash<Machine::signed_number_t>
 {
 public:
     std::size_t operator()(const Machine::signed_number_t &arg) const
-        { return std::hash<std::vector<Machine::index_t>>{}(arg.abs().digits()); }
+        { return std::hash<Machine::unsigned_number_t::digits_t>{}(arg.abs().digits()); }
 };
 
@@ -23,7 +23,7 @@ namespace Machine
     output_terminator_t output_t::terminator_{};
 
     output_t::output_t(const output_t &arg) :
-        device_t{std::unique_ptr<encoder_t>{arg.encoder_->clone()}}, string_{arg.string_} {}
+        device_t{arg.encoder_}, string_{arg.string_} {}
 
     output_t &output_t::operator=(const output_t &arg) { return *this = output_t{arg}; }
 
@@ -43,6 +43,18 @@ namespace Machine
 
     std::string output_t::print_state() const { return string_.print_state(encoder()); }
 
+    index_t output_t::n_observations() const { return 1; }
+
+    index_t output_t::observation() const { return 0; }
+
+    void output_t::observe(index_t) { return; }
+
+    void output_t::configuration(std::vector<index_t> &arg) const
+        { return append_configuration(arg, string_); }
+
+    void output_t::restore_configuration(std::span<const index_t> &arg)
+        { return extract_configuration(arg, string_); }
+
     string_t &output_t::string() { return string_; }
 
     const string_t &output_t::string() const { return string_; }
@@ -53,6 +53,11 @@ namespace Machine
         const output_terminator_t &terminator() const override;
         std::string print_name() const override;
         std::string print_state() const override;
+        index_t n_observations() const override;
+        index_t observation() const override;
+        void observe(index_t) override;
+        void configuration(std::vector<index_t> &) const override;
+        void restore_configuration(std::span<const index_t> &) override;
 
         string_t &string();
         const string_t &string() const;
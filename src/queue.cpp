@@ -14,11 +14,11 @@ namespace Machine
     void queue_initialiser_string_t::initialise(device_t &device, const std::string &string) const
     {
         string_t encoded_string = device.encoder()(string);
-        std::deque<character_t> &queue = dynamic_cast<queue_t &>(device).queue();
+        Apparatus::packed_vector_t &queue = dynamic_cast<queue_t &>(device).queue();
 
         queue.clear();
-        for (auto c : encoded_string)
-            queue.push_front(c);
+        for (auto i = std::crbegin(encoded_string); i != std::crend(encoded_string); ++i)
+            queue.push_back(*i);
     }
 
     queue_terminator_empty_t *queue_terminator_empty_t::clone() const
@@ -37,21 +37,21 @@ namespace Machine
 
     std::string queue_terminator_string_t::terminate(const device_t &device) const
     {
-        const std::deque<character_t> &queue = dynamic_cast<const queue_t &>(device).queue();
+        const Apparatus::packed_vector_t &queue = dynamic_cast<const queue_t &>(device).queue();
 
         std::string ret;
 
-        for (auto it = std::crbegin(queue); it != std::crend(queue); ++it)
-            ret.push_back(device.encoder()(*it));
+        for (index_t i = std::size(queue); i != 0; --i)
+            ret.push_back(device.encoder()(queue[i - 1]));
 
         return ret;
     }
 
     queue_t::queue_t(const queue_t &arg) :
-        device_t{std::unique_ptr<encoder_t>{arg.encoder_->clone()}},
+        device_t{arg.encoder_},
         queue_{arg.queue_},
-        initialiser_{std::unique_ptr<queue_initialiser_t>{arg.initialiser_->clone()}},
-        terminator_{std::unique_ptr<queue_terminator_t>{arg.terminator_->clone()}} {}
+        initialiser_{arg.initialiser_},
+        terminator_{arg.terminator_} {}
 
     queue_t &queue_t::operator=(const queue_t &arg) { return *this = queue_t{arg}; }
 
@@ -64,12 +64,14 @@ namespace Machine
     {
         if (not encoder_)
             encoder_.reset(new encoder_ascii_t{});
+
+        queue_ = Apparatus::packed_vector_t{encoder_->alphabet().max_character()};
     }
 
     queue_t *queue_t::clone() const { return new queue_t{*this}; }
 
-    std::deque<character_t> &queue_t::queue() { return queue_; }
-    const std::deque<character_t> &queue_t::queue() const { return queue_; }
+    Apparatus::packed_vector_t &queue_t::queue() { return queue_; }
+    const Apparatus::packed_vector_t &queue_t::queue() const { return queue_; }
     const queue_initialiser_t &queue_t::initialiser() const { return *initialiser_; }
     const queue_terminator_t &queue_t::terminator() const { return *terminator_; }
     
@@ -78,12 +80,50 @@ namespace Machine
     std::string queue_t::print_state() const
     {
         std::string ret;
-        for (character_t c : queue_)
-            ret.push_back(encoder()(c));
+        for (index_t i = 0; i != std::size(queue_); ++i)
+            ret.push_back(encoder()(queue_[i]));
 
         return ret;
     }
 
+    index_t queue_t::n_observations() const
+        { return index_t{encoder().alphabet().max_character()} + 2; }
+
+    index_t queue_t::observation() const { return std::empty(queue_) ? 0 : queue_.front() + 1; }
+
+    void queue_t::observe(index_t arg)
+    {
+        queue_.clear();
+        if (arg != 0)
+            queue_.push_back(arg - 1);
+
+        return;
+    }
+
+    void queue_t::configuration(std::vector<index_t> &arg) const
+    {
+        arg.emplace_back(std::size(queue_));
+
+        for (index_t i = 0; i != std::size(queue_); ++i)
+            arg.emplace_back(queue_[i]);
+
+        return;
+    }
+
+    void queue_t::restore_configuration(std::span<const index_t> &arg)
+    {
+        const index_t n = arg[0];
+
+        queue_.clear();
+
+        for (index_t i = 0; i != n; ++i)
+            queue_.push_back(arg[1 + i]);
+
+        arg = arg.subspan(1 + n);
+
+        return;
+    }
+
     bool queue_operation_t::correct_device(const device_t &device) const
         { return typeid(device) == typeid(queue_t); }
 
@@ -119,7 +159,7 @@ namespace Machine
 
     bool queue_operation_dequeue_t::applicable(const device_t &device) const
     {
-        const std::deque<character_t> &queue = dynamic_cast<const queue_t &>(device).queue();
+        const Apparatus::packed_vector_t &queue = dynamic_cast<const queue_t &>(device).queue();
 
         return (not std::empty(queue) and queue.front() == character_);
     }
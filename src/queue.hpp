@@ -1,8 +1,6 @@
 #pragma once
 #include "machine.hpp"
 
-#include <deque>
-
 namespace Machine
 {
     class queue_t;
@@ -68,9 +66,9 @@ namespace Machine
     class queue_t final : public device_t
     {
     private:
-        std::deque<character_t> queue_{};
-        std::unique_ptr<queue_initialiser_t> initialiser_;
-        std::unique_ptr<queue_terminator_t> terminator_;
+        Apparatus::packed_vector_t queue_{};
+        std::shared_ptr<const queue_initialiser_t> initialiser_;
+        std::shared_ptr<const queue_terminator_t> terminator_;
 
     public:
         queue_t() = delete;
@@ -88,12 +86,17 @@ namespace Machine
         queue_t *clone() const override;
             
     public:
-        std::deque<character_t> &queue();
-        const std::deque<character_t> &queue() const;
+        Apparatus::packed_vector_t &queue();
+        const Apparatus::packed_vector_t &queue() const;
         const queue_initialiser_t &initialiser() const override;
         const queue_terminator_t &terminator() const override;
         std::string print_name() const override;
         std::string print_state() const override;
+        index_t n_observations() const override;
+        index_t observation() const override;
+        void observe(index_t) override;
+        void configuration(std::vector<index_t> &) const override;
+        void restore_configuration(std::span<const index_t> &) override;
     };
 
     class queue_operation_t : public operation_t
@@ -1,7 +1,103 @@
 #include "ram.hpp"
 
+#include <algorithm>
+#include <bit>
+
 namespace Machine
 {
+    namespace Apparatus
+    {
+        const unsigned_number_t &ram_memory_t::load(const unsigned_number_t &address) const
+        {
+            const index_t i = dense_address(address);
+
+            if (i != negative_1)
+                return i < std::size(dense_) ? dense_[i] : zero_;
+
+            auto it = sparse_->find(address);
+
+            return it == std::cend(*sparse_) ? zero_ : it->second;
+        }
+
+        void ram_memory_t::store(const unsigned_number_t &address, const unsigned_number_t &value)
+        {
+            const index_t i = dense_address(address);
+
+            if (i != negative_1)
+            {
+                if (i >= std::size(dense_))
+                {
+                    if (value.zero())
+                        return;
+
+                    dense_.resize(i + 1);
+                    live_.resize(i / n_digits + 1);
+                }
+
+                dense_.mutate(i) = value;
+
+                const index_t bit = index_t{1} << (i % n_digits);
+
+                if (value.zero() == static_cast<bool>(live_[i / n_digits] & bit))
+                    live_.mutate(i / n_digits) ^= bit;
+
+                // Clearing the highest entry lowers dense_ to the next non-zero one
+                if (value.zero() and i + 1 == std::size(dense_))
+                {
+                    while (not std::empty(live_) and live_.back() == 0)
+                        live_.pop_back();
+
+                    dense_.resize(std::empty(live_) ? 0 :
+                        (std::size(live_) - 1) * n_digits + std::bit_width(live_.back()));
+                }
+
+                return;
+            }
+
+            if (not value.zero())
+                sparse_.mutate().insert_or_assign(address, value);
+            else if (sparse_->contains(address))
+                sparse_.mutate().erase(address);
+
+            return;
+        }
+
+        std::vector<std::pair<unsigned_number_t, unsigned_number_t>> ram_memory_t::entries() const
+        {
+            std::vector<std::pair<unsigned_number_t, unsigned_number_t>> ret;
+
+            for (index_t i = 0; i != std::size(live_); ++i)
+                for (index_t word = live_[i]; word != 0; word &= word - 1)
+                {
+                    const index_t j = i * n_digits + std::countr_zero(word);
+                    ret.emplace_back(j, dense_[j]);
+                }
+
+            const index_t n = std::size(ret);
+
+            for (const auto &i : *sparse_)
+                ret.emplace_back(i);
+
+            std::ranges::sort(std::begin(ret) + n, std::end(ret), {},
+                &std::pair<unsigned_number_t, unsigned_number_t>::first);
+
+            return ret;
+        }
+
+        index_t ram_memory_t::dense_address(const unsigned_number_t &address) noexcept
+        {
+            const unsigned_number_t::digits_t &digits = address.digits();
+
+            if (std::empty(digits))
+                return 0;
+
+            if (std::size(digits) == 1 and digits.front() < dense_size)
+                return digits.front();
+
+            return negative_1;
+        }
+    }
+
     ram_initialiser_empty_t *ram_initialiser_empty_t::clone() const
         { return new ram_initialiser_empty_t{*this}; }
 
@@ -66,7 +162,7 @@ namespace Machine
 
         for (index_t i = 0; i != n; ++i)
         {
-            ret += static_cast<const unsigned_number_t &>(ram[i]).print(extended_encoder);
+            ret += ram[i].print(extended_encoder);
 
             if (i != n - 1)
                 ret += separator;
@@ -75,39 +171,9 @@ namespace Machine
         return ret;
     }
 
-    ram_t::register_proxy_t::register_proxy_t(ram_t &ram, index_t i) :
-        i_{i}, registers_{ram.registers_} {}
-
-    ram_t::register_proxy_t &ram_t::register_proxy_t::operator=(unsigned_number_t arg)
-    {
-        if (i_ >= std::size(registers_))
-            registers_.resize(i_ + 1);
-        registers_[i_] = std::move(arg);
-
-        return *this;
-    }
-
-    ram_t::register_proxy_t::operator unsigned_number_t &()
-    {
-        if (i_ >= std::size(registers_))
-            registers_.resize(i_ + 1);
-
-        return registers_[i_];
-    }
-
-    ram_t::register_const_proxy_t::register_const_proxy_t(const ram_t &ram, index_t i) :
-        i_{i}, registers_{ram.registers_} {}
-
-    ram_t::register_const_proxy_t::operator const unsigned_number_t &()
-    {
-        if (i_ >= std::size(registers_))
-            return zero_;
-
-        return registers_[i_];
-    }
-
-    ram_t::ram_t(const ram_t &arg) : device_t{std::unique_ptr<encoder_t>(arg.encoder_->clone())},
-        registers_{arg.registers_}, memory_{arg.memory_} {}
+    ram_t::ram_t(const ram_t &arg) : device_t{arg.encoder_},
+        initialiser_{arg.initialiser_}, terminator_{arg.terminator_},
+        registers_{arg.registers_}, memory_{arg.memory_}, reserved_{arg.reserved_} {}
 
     ram_t::ram_t(std::unique_ptr<encoder_t> encoder, std::unique_ptr<ram_initialiser_t> initialiser,
         std::unique_ptr<ram_terminator_t> terminator) :
@@ -141,11 +207,11 @@ namespace Machine
             ret += 'r';
             ret += std::to_string(i);
             ret += separator;
-            ret += registers_[i].print(extended_encoder);
+            ret += (*registers_)[i].print(extended_encoder);
             ret += separator;
         }
 
-        for (const auto &i : memory_)
+        for (const auto &i : memory_.entries())
         {
             ret += 'm';
             ret += i.first.print(extended_encoder);
@@ -160,26 +226,106 @@ namespace Machine
         return ret;
     }
 
+    void ram_t::configuration(std::vector<index_t> &arg) const
+    {
+        const index_t n = n_registers();
+
+        arg.emplace_back(n);
+
+        for (index_t i = 0; i != n; ++i)
+            append_configuration(arg, (*registers_)[i]);
+
+        const index_t pos = std::size(arg);
+        arg.emplace_back(0);
+
+        for (const auto &i : memory_.entries())
+        {
+            append_configuration(arg, i.first);
+            append_configuration(arg, i.second);
+            ++arg[pos];
+        }
+
+        return;
+    }
+
+    void ram_t::restore_configuration(std::span<const index_t> &arg)
+    {
+        clear();
+
+        const index_t n = arg[0];
+        arg = arg.subspan(1);
+
+        std::vector<unsigned_number_t> &registers = registers_.mutate();
+
+        if (n > std::size(registers))
+            registers.resize(n);
+
+        for (index_t i = 0; i != n; ++i)
+            extract_configuration(arg, registers[i]);
+
+        const index_t m = arg[0];
+        arg = arg.subspan(1);
+
+        for (index_t i = 0; i != m; ++i)
+        {
+            unsigned_number_t address;
+            unsigned_number_t value;
+            extract_configuration(arg, address);
+            extract_configuration(arg, value);
+            memory_.store(address, value);
+        }
+
+        return;
+    }
+
     void ram_t::clear()
     {
-        registers_.clear();
-        memory_.clear();
+        registers_ = std::vector<unsigned_number_t>(reserved_);
+        memory_ = {};
 
         return;
     }
 
-    ram_t::register_proxy_t ram_t::operator[](index_t i) { return {*this, i}; }
+    void ram_t::reserve(index_t n)
+    {
+        if (n <= reserved_)
+            return;
 
-    ram_t::register_const_proxy_t ram_t::operator[](index_t i) const { return {*this, i}; }
+        reserved_ = n;
 
-    std::map<unsigned_number_t, unsigned_number_t> &ram_t::memory() { return memory_; }
+        if (n > std::size(*registers_))
+            registers_.mutate().resize(n);
+
+        return;
+    }
+
+    unsigned_number_t &ram_t::operator[](index_t i)
+    {
+        std::vector<unsigned_number_t> &registers = registers_.mutate();
+
+        if (i >= std::size(registers))
+            registers.resize(i + 1);
+
+        return registers[i];
+    }
+
+    const unsigned_number_t &ram_t::operator[](index_t i) const
+        { return i < std::size(*registers_) ? (*registers_)[i] : zero_; }
+
+    std::vector<unsigned_number_t> &ram_t::registers() { return registers_.mutate(); }
+
+    const std::vector<unsigned_number_t> &ram_t::registers() const { return *registers_; }
+
+    Apparatus::ram_memory_t &ram_t::memory() { return memory_; }
+
+    const Apparatus::ram_memory_t &ram_t::memory() const { return memory_; }
 
     index_t ram_t::n_registers() const
     {
-        auto it = std::find_if(std::crbegin(registers_), crend(registers_),
+        auto it = std::find_if(std::crbegin(*registers_), crend(*registers_),
                 [](const unsigned_number_t &a) { return not a.zero(); });
 
-        return std::distance(it, std::crend(registers_));
+        return std::distance(it, std::crend(*registers_));
     }
 
     bool ram_operation_t::correct_device(const device_t &device) const
@@ -210,16 +356,7 @@ namespace Machine
         ram_t &ram = dynamic_cast<ram_t &>(device);
         const ram_t &cram = ram;
 
-        const auto &memory = ram.memory();
-
-        const unsigned_number_t &address = cram[reg_source_];
-
-        auto it = memory.find(address);
-
-        if (it == std::cend(memory))
-            ram[reg_destination_] = 0;
-        else
-            ram[reg_destination_] = it->second;
+        ram[reg_destination_] = cram.memory().load(cram[reg_source_]);
 
         return;
     }
@@ -238,15 +375,7 @@ namespace Machine
         ram_t &ram = dynamic_cast<ram_t &>(device);
         const ram_t &cram = ram;
 
-        auto &memory = ram.memory();
-
-        const unsigned_number_t &address = cram[reg_destination_];
-        auto it = memory.find(address);
-
-        if (it == std::cend(memory))
-            memory.emplace(address, cram[reg_source_]);
-        else
-            it->second = cram[reg_source_];
+        ram.memory().store(cram[reg_destination_], cram[reg_source_]);
 
         return;
     }
@@ -311,10 +440,12 @@ namespace Machine
     void ram_operation_halve_t::apply(device_t &device) const
     {
         ram_t &ram = dynamic_cast<ram_t &>(device);
+        const ram_t &cram = ram;
 
-        const unsigned_number_t &arg = ram[reg_source_];
-
-        ram[reg_destination_] = arg >> 1;
+        if (reg_destination_ == reg_source_)
+            ram[reg_destination_] >>= 1;
+        else
+            ram[reg_destination_] = cram[reg_source_] >> 1;
 
         return;
     }
@@ -373,8 +504,7 @@ namespace Machine
     {
         const ram_t &ram = dynamic_cast<const ram_t &>(device);
 
-        return static_cast<const unsigned_number_t &>(ram[reg_source_0_]) >
-            static_cast<const unsigned_number_t &>(ram[reg_source_1_]);
+        return ram[reg_source_0_] > ram[reg_source_1_];
     }
 
     bool ram_operation_test_gr_t::intersecting_domain(const operation_t &operation) const
@@ -419,8 +549,7 @@ namespace Machine
     {
         const ram_t &ram = dynamic_cast<const ram_t &>(device);
 
-        return static_cast<const unsigned_number_t &>(ram[reg_source_0_]) ==
-            static_cast<const unsigned_number_t &>(ram[reg_source_1_]);
+        return ram[reg_source_0_] == ram[reg_source_1_];
     }
 
     bool ram_operation_test_eq_t::intersecting_domain(const operation_t &operation) const
@@ -447,7 +576,10 @@ namespace Machine
         { return new ram_operation_test_odd_t{*this}; }
 
     bool ram_operation_test_odd_t::applicable(const device_t &device) const
-        { return dynamic_cast<const ram_t &>(device)[reg_source_] % 2 == 1; }
+    {
+        const unsigned_number_t &arg = dynamic_cast<const ram_t &>(device)[reg_source_];
+        return arg.odd();
+    }
 
     bool ram_operation_test_odd_t::intersecting_domain(const operation_t &operation) const
     {
@@ -464,7 +596,10 @@ namespace Machine
         { return new ram_operation_test_even_t{*this}; }
 
     bool ram_operation_test_even_t::applicable(const device_t &device) const
-        { return dynamic_cast<const ram_t &>(device)[reg_source_] % 2 == 0; }
+    {
+        const unsigned_number_t &arg = dynamic_cast<const ram_t &>(device)[reg_source_];
+        return not arg.odd();
+    }
 
     bool ram_operation_test_even_t::intersecting_domain(const operation_t &operation) const
     {
@@ -2,10 +2,15 @@
 #include "machine.hpp"
 #include "number.hpp"
 
-#include <map>
+#include <unordered_map>
 
 namespace Machine
 {
+    namespace Apparatus
+    {
+        class ram_memory_t;
+    }
+
     class ram_t;
     class ram_operation_t;
     class ram_operation_load_t;
@@ -78,60 +83,51 @@ namespace Machine
         std::string terminate(const device_t &) const override;
     };
 
-    class ram_t final : public device_t
+    namespace Apparatus
     {
-    private:
-        class register_proxy_t
+        class ram_memory_t
         {
         private:
-            const index_t i_;
-            std::vector<unsigned_number_t> &registers_;
+            static constexpr index_t dense_size = index_t{1} << 16;
+            static constexpr index_t n_digits = std::numeric_limits<index_t>::digits;
+            static const inline unsigned_number_t zero_{0};
 
-        public:
-            register_proxy_t() = delete;
-            ~register_proxy_t() = default;
+            using sparse_t = std::unordered_map<unsigned_number_t, unsigned_number_t>;
 
-            register_proxy_t(const register_proxy_t &) = delete;
-            register_proxy_t &operator=(const register_proxy_t &) = delete;
-
-            register_proxy_t(register_proxy_t &&) noexcept = delete;
-            register_proxy_t &operator=(register_proxy_t &&) noexcept = delete;
-
-            register_proxy_t(ram_t &, index_t);
-
-            register_proxy_t &operator=(unsigned_number_t);
-
-            operator unsigned_number_t &();
-        };
-
-        class register_const_proxy_t
-        {
-        private:
-            const index_t i_;
-            const std::vector<unsigned_number_t> &registers_;
+            cow_vector_t<unsigned_number_t, 64> dense_{}; // Up to the highest non-zero address
+            cow_vector_t<index_t, 64> live_{}; // One bit per non-zero entry of dense_
+            cow_t<sparse_t> sparse_{};
 
         public:
-            register_const_proxy_t() = delete;
-            ~register_const_proxy_t() = default;
+            ram_memory_t() = default;
+            ~ram_memory_t() = default;
 
-            register_const_proxy_t(const register_const_proxy_t &) = delete;
-            register_const_proxy_t &operator=(const register_const_proxy_t &) = delete;
+            ram_memory_t(const ram_memory_t &) noexcept = default;
+            ram_memory_t &operator=(const ram_memory_t &) noexcept = default;
 
-            register_const_proxy_t(register_const_proxy_t &&) noexcept = delete;
-            register_const_proxy_t &operator=(register_const_proxy_t &&) noexcept = delete;
+            ram_memory_t(ram_memory_t &&) noexcept = default;
+            ram_memory_t &operator=(ram_memory_t &&) noexcept = default;
 
-            register_const_proxy_t(const ram_t &, index_t);
+        public:
+            const unsigned_number_t &load(const unsigned_number_t &) const;
+            void store(const unsigned_number_t &, const unsigned_number_t &);
+            std::vector<std::pair<unsigned_number_t, unsigned_number_t>> entries() const;
 
-            operator const unsigned_number_t &();
+        private:
+            static index_t dense_address(const unsigned_number_t &) noexcept;
         };
+    }
 
+    class ram_t final : public device_t
+    {
     private:
         static const inline unsigned_number_t zero_{0};
 
-        std::unique_ptr<ram_initialiser_t> initialiser_;
-        std::unique_ptr<ram_terminator_t> terminator_;
-        std::vector<unsigned_number_t> registers_{};
-        std::map<unsigned_number_t, unsigned_number_t> memory_{};
+        std::shared_ptr<const ram_initialiser_t> initialiser_;
+        std::shared_ptr<const ram_terminator_t> terminator_;
+        Apparatus::cow_t<std::vector<unsigned_number_t>> registers_{};
+        Apparatus::ram_memory_t memory_{};
+        index_t reserved_{0};
 
     public:
         ram_t() = delete;
@@ -152,11 +148,17 @@ namespace Machine
         const ram_terminator_t &terminator() const override;
         std::string print_name() const override;
         std::string print_state() const override;
+        void configuration(std::vector<index_t> &) const override;
+        void restore_configuration(std::span<const index_t> &) override;
 
         void clear();
-        register_proxy_t operator[](index_t);
-        register_const_proxy_t operator[](index_t) const;
-        std::map<unsigned_number_t, unsigned_number_t> &memory();
+        void reserve(index_t);
+        unsigned_number_t &operator[](index_t);
+        const unsigned_number_t &operator[](index_t) const;
+        std::vector<unsigned_number_t> &registers();
+        const std::vector<unsigned_number_t> &registers() const;
+        Apparatus::ram_memory_t &memory();
+        const Apparatus::ram_memory_t &memory() const;
         index_t n_registers() const;
     };
 
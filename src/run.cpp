@@ -2,6 +2,8 @@
 
 #include <iostream>
 #include <sstream>
+#include <fstream>
+#include <iterator>
 #include <cctype>
 #include <algorithm>
 
@@ -48,13 +50,26 @@ int main(int argc, const char **argv)
     std::vector<std::string> inputs;
     std::vector<std::string> outputs;
     bool pause_halt = true;
+    bool deduplicate = false;
+    bool retain_halted = false;
     bool tui = false;
+    bool batch = false;
+    std::string batch_file;
     bool check_deterministic = false;
     bool deterministic;
     index_t time = negative_1;
     index_t n_threads = negative_1;
+    index_t quantum = negative_1;
+    index_t n_classes = 0;
+    console_t::strategy_t strategy = console_t::strategy_t::breadth_first;
+    index_t depth_bound = negative_1;
+    std::string priority;
+    index_t frontier_cap = negative_1;
+    index_t memory_budget = negative_1;
+    console_t::overflow_t overflow = console_t::overflow_t::spill;
     bool verbose = false;
     bool verbose_output = false;
+    bool verbose_count = false;
 
     auto error = [&verbose] (int ret, const std::string &msg) -> int
     {
@@ -75,19 +90,46 @@ int main(int argc, const char **argv)
                 "\n\t-p\t\tSpecify the program name"
                 "\n\t-i\t\tInput for all devices"
                 "\n\t-I\t\tA set of inputs, one for each device"
+                "\n\t-if\t\tRead the input for all devices from the given file, without its"
+                "\n\t\t\ttrailing newlines"
                 "\n\t-o\t\tA single output to be searched in all devices output for a match"
                 "\n\t-O\t\tA set of ouputs to be matched in every device"
+                "\n\t-b\t\tBatch mode: read one input per line from the given file (or from"
+                "\n\t\t\tthe standard input if no file is given) and print one line per input"
+                "\n\t\t\twith the input and the return value of its run. Each input is explored"
+                "\n\t\t\tbreadth-first with its own frontier, capped by -mf and -mb (by default"
+                "\n\t\t\t2^16 machines): once full the input does not halt in time (7) unless"
+                "\n\t\t\t-ov prune drops the machines beyond the cap"
                 "\n\t-nph\t\tDo not pause the run_all command if a machine halts"
+                "\n\t-nc\t\tStop the simulation once the specified number of outputs is found"
+                "\n\t-s\t\t[bfs, dfs, id or bf] exploration strategy: breadth-first (default),"
+                "\n\t\t\tdepth-first, iterative deepening or best-first"
+                "\n\t-db\t\tSpecify the maximum number of steps explored by dfs, id and the"
+                "\n\t\t\tbatch mode"
+                "\n\t-pr\t\t[steps or size] priority of bf: fewest steps or smallest configuration"
+                "\n\t-mf\t\tSpecify the maximum number of running machines kept in memory"
+                "\n\t-mb\t\tSpecify the memory budget of the running machines (in MiB)"
+                "\n\t-ov\t\t[spill or prune] what to do with the machines beyond the limit:"
+                "\n\t\t\tspill them to a temporary file (default) or discard them"
+                "\n\t-u\t\tPrune the machines whose configuration has already been visited in as"
+                "\n\t\t\tmany or fewer steps"
+                "\n\t-r\t\tRetain every halted machine instead of one for each output"
                 "\n\t-tui\t\tLaunch the tui (i.e. run interactively)"
                 "\n\t-d\t\t[Yes or No] assert that the program is or not deterministic"
                 "\n\t-t\t\tSpecify the waiting time for the run (in seconds)"
                 "\n\t-nt\t\tSpecify the number of threads used in the simulation"
+                "\n\t-q\t\tSpecify the number of steps a thread runs a machine before "
+                "rebalancing"
                 "\n\t-v\t\tVerbose: print error messages"
                 "\n\t-vo\t\tPrint the output"
+                "\n\t-vc\t\tPrint the output preceded by the number of halted machines of each"
+                "\n\t\t\toutput class, as in '3: Accept'"
                 "\n\nNote:"
                 "\n\tWhen specifying the input and output, an empty string is represented by '\\'."
                 "\n\tTo specify any string starting with '-', or '\\' enter the string"
                 "\n\tpreceded by a single additional '\\' character."
+                "\n\tThe same rule applies to each line of the batch input, where an empty line is"
+                "\n\tan empty input."
                 "\n\nReturn value:"
                 "\n\t0\t\tThe program run without errors"
                 "\n\t1\t\tError reading the command"
@@ -96,7 +138,9 @@ int main(int argc, const char **argv)
                 "\n\t4\t\tMismatch in the number of outputs and devices"
                 "\n\t5\t\tThe specified output does not match the obtained one"
                 "\n\t6\t\tThe deterministic assertion failed"
-                "\n\t7\t\tThe program did not halt in the specified time";
+                "\n\t7\t\tThe program did not halt in the specified time"
+                "\n\t8\t\tThe simulation failed"
+                "\n\t9\t\tThe input is not valid for the program";
 
             std::cout << std::endl;
 
@@ -120,6 +164,22 @@ int main(int argc, const char **argv)
                 input = std::string{++std::cbegin(input), std::cend(input)};
             empty_input = false;
         }
+        else if (s == "-if")
+        {
+            if (++argi >= argc)
+                return error(1, "Expected the input file after -if");
+
+            std::ifstream file{argv[argi]};
+            if (not file)
+                return error(1, std::string{"Cannot open the input file "} + argv[argi]);
+
+            input.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+            while (not std::empty(input) and input.back() == '\n')
+                input.pop_back();
+
+            empty_input = false;
+            ++argi;
+        }
         else if (s == "-I")
         {
             for (++argi; argi < argc; ++argi)
@@ -166,11 +226,98 @@ int main(int argc, const char **argv)
             if (std::empty(outputs))
                 return error(1, "Expected the list of outputs after -O");
         }
+        else if (s == "-b")
+        {
+            batch = true;
+            if (++argi < argc and argv[argi][0] != '-')
+                batch_file = argv[argi++];
+        }
         else if (s == "-nph")
         {
             pause_halt = false;
             ++argi;
         }
+        else if (s == "-u")
+        {
+            deduplicate = true;
+            ++argi;
+        }
+        else if (s == "-r")
+        {
+            retain_halted = true;
+            ++argi;
+        }
+        else if (s == "-nc")
+        {
+            if (++argi >= argc)
+                return error(1, "Expected a number after -nc");
+            n_classes = std::atoll(argv[argi++]);
+            if (n_classes == 0)
+                return error(1, "Expected a number after -nc");
+        }
+        else if (s == "-s")
+        {
+            if (++argi >= argc)
+                return error(1, "Expected \"bfs\", \"dfs\", \"id\" or \"bf\" after -s");
+            std::string s{argv[argi++]};
+
+            if (s == "bfs")
+                strategy = console_t::strategy_t::breadth_first;
+            else if (s == "dfs")
+                strategy = console_t::strategy_t::depth_first;
+            else if (s == "id")
+                strategy = console_t::strategy_t::iterative_deepening;
+            else if (s == "bf")
+                strategy = console_t::strategy_t::best_first;
+            else
+                return error(1, "Expected \"bfs\", \"dfs\", \"id\" or \"bf\" after -s");
+        }
+        else if (s == "-db")
+        {
+            if (++argi >= argc)
+                return error(1, "Expected a number after -db");
+            depth_bound = std::atoll(argv[argi++]);
+            if (depth_bound == 0)
+                return error(1, "Expected a number after -db");
+        }
+        else if (s == "-pr")
+        {
+            if (++argi >= argc)
+                return error(1, "Expected \"steps\" or \"size\" after -pr");
+            priority = argv[argi++];
+            if (priority != "steps" and priority != "size")
+                return error(1, "Expected \"steps\" or \"size\" after -pr");
+        }
+        else if (s == "-mf")
+        {
+            if (++argi >= argc)
+                return error(1, "Expected a number after -mf");
+            frontier_cap = std::atoll(argv[argi++]);
+            if (frontier_cap == 0)
+                return error(1, "Expected a number after -mf");
+        }
+        else if (s == "-mb")
+        {
+            if (++argi >= argc)
+                return error(1, "Expected a number after -mb");
+            memory_budget = std::atoll(argv[argi++]);
+            if (memory_budget == 0)
+                return error(1, "Expected a number after -mb");
+            memory_budget <<= 20;
+        }
+        else if (s == "-ov")
+        {
+            if (++argi >= argc)
+                return error(1, "Expected \"spill\" or \"prune\" after -ov");
+            std::string s{argv[argi++]};
+
+            if (s == "spill")
+                overflow = console_t::overflow_t::spill;
+            else if (s == "prune")
+                overflow = console_t::overflow_t::prune;
+            else
+                return error(1, "Expected \"spill\" or \"prune\" after -ov");
+        }
         else if (s == "-tui")
         {
             tui = true;
@@ -208,6 +355,14 @@ int main(int argc, const char **argv)
             if (n_threads == 0)
                 return error(1, "Expected a number after -nt");
         }
+        else if (s == "-q")
+        {
+            if (++argi >= argc)
+                return error(1, "Expected a number after -q");
+            quantum = std::atoll(argv[argi++]);
+            if (quantum == 0)
+                return error(1, "Expected a number after -q");
+        }
         else if (s == "-v")
         {
             verbose = true;
@@ -218,6 +373,12 @@ int main(int argc, const char **argv)
             verbose_output = true;
             ++argi;
         }
+        else if (s == "-vc")
+        {
+            verbose_output = true;
+            verbose_count = true;
+            ++argi;
+        }
         else
             return error(1, std::string{"Unrecognised option "} + s);
     }
@@ -240,12 +401,21 @@ int main(int argc, const char **argv)
     if (std::empty(program_name) and not (empty_input and std::empty(inputs)))
         return error(1, "Cannot specify the input without specifying the program");
 
-    if ((empty_input and std::empty(inputs) and not tui) or
+    if (batch and (tui or not empty_input or not std::empty(inputs)))
+        return error(1, "In batch mode the inputs are read from the batch file");
+
+    if (batch and (strategy != console_t::strategy_t::breadth_first or not std::empty(priority)))
+        return error(1, "In batch mode every input is explored breadth-first");
+
+    if ((empty_input and std::empty(inputs) and not tui and not batch) or
         (not empty_input and not std::empty(inputs)))
         return error(1, "If not in interactive mode the input must be specified");
 
     if (not empty_input)
-        console.initialise(input);
+    {
+        try { console.initialise(input); }
+        catch (std::runtime_error &e) { return error(9, e.what()); }
+    }
     else if (not std::empty(inputs))
     {
         try { console.initialise_individually(inputs); }
@@ -254,18 +424,114 @@ int main(int argc, const char **argv)
     }
 
     console.pause_halt() = pause_halt;
+    console.deduplicate() = deduplicate;
+    console.retain_halted() = retain_halted;
+
+    if (quantum != negative_1)
+        console.quantum() = quantum;
+
+    if (not empty_output)
+        console.search_output(output);
+
+    console.search_classes(n_classes);
+    console.strategy(strategy);
+    console.depth_bound() = depth_bound;
+    console.frontier_cap() = frontier_cap;
+    console.memory_budget() = memory_budget;
+    console.overflow(overflow);
+
+    if (priority == "size")
+        console.priority([](const machine_t &m) { return std::size(m.configuration()); });
 
     if (check_deterministic and deterministic !=
             (console.state() & console_t::console_state_t::deterministic))
         return error(6, "Failed deterministic check");
     
+    if (batch)
+    {
+        std::vector<std::string> batch_inputs;
+        std::ifstream file;
+
+        if (not std::empty(batch_file))
+        {
+            file.open(batch_file);
+            if (not file)
+                return error(1, "Cannot open the batch file " + batch_file);
+        }
+
+        std::istream &stream = std::empty(batch_file) ? std::cin : file;
+
+        for (std::string line; std::getline(stream, line);)
+        {
+            if (not std::empty(line) and line.front() == '\\')
+                line.erase(std::begin(line));
+            batch_inputs.emplace_back(std::move(line));
+        }
+
+        console.run_batch(batch_inputs);
+        if (time != negative_1 and not console.wait_for(std::chrono::seconds{time}))
+            console.pause();
+
+        try { console.wait(); }
+        catch (std::exception &e) { return error(8, e.what()); }
+
+        const auto &results = console.batch_output();
+        int ret = 0;
+
+        for (index_t i = 0; i != std::size(batch_inputs); ++i)
+        {
+            const std::string &s = batch_inputs[i];
+            const auto &result = results[i].output_;
+            int code = 0;
+
+            if (results[i].state_ == machine_t::machine_state_t::invalid)
+                code = 9;
+            else if (results[i].state_ == machine_t::machine_state_t::running)
+                code = 7;
+            else if (not empty_output and std::ranges::none_of(result, [&output]
+                    (const auto &j) { return std::ranges::find(j, output) != std::cend(j); }))
+                code = 5;
+            else if (not std::empty(outputs))
+            {
+                if (std::ranges::any_of(result,
+                        [&outputs] (const auto &j) { return std::size(j) != std::size(outputs); }))
+                    code = 4;
+                else if (std::size(result) != 1 or result.front() != outputs)
+                    code = 5;
+            }
+
+            if (std::empty(s))
+                std::cout << '\\';
+            else if (s.front() == '-' or s.front() == '\\')
+                std::cout << '\\' << s;
+            else
+                std::cout << s;
+
+            std::cout << '\t' << code;
+
+            if (verbose_output)
+                for (const auto &j : result)
+                {
+                    std::cout << "\t|";
+                    for (const auto &k : j)
+                        std::cout << ' ' << k;
+                }
+
+            std::cout << '\n';
+            ret = std::max(ret, code);
+        }
+
+        return ret;
+    }
+
     if (not tui)
     {
         console.run_all();
-        if (time == negative_1)
-            console.wait();
-        else if (not console.wait_for(std::chrono::seconds{time}))
+        if (time != negative_1 and not console.wait_for(std::chrono::seconds{time}))
             return error(7, "The simulation has not finished in the prescribed time");
+
+        try { console.wait(); }
+        catch (std::exception &e) { return error(8, e.what()); }
     }
 
     else
@@ -277,9 +543,21 @@ int main(int argc, const char **argv)
     {
         std::cout << std::to_string(std::size(output_strings)) << " output classes.\n";
 
+        if (deduplicate)
+            std::cout << std::to_string(console.pruned_counter()) << " pruned machines.\n";
+
+        if (frontier_cap != negative_1 or memory_budget != negative_1)
+            std::cout << std::to_string(console.spilled_counter()) << " spilled machines.\n"
+                << std::to_string(console.dropped_counter()) << " dropped machines.\n";
+
+        for (const auto &i : console.print_fusions())
+            std::cout << i << ".\n";
+
         for (const auto &i : output_strings)
         {
             std::cout << "\t";
+            if (verbose_count)
+                std::cout << std::to_string(console.output_count(i)) << ':';
             for (const auto &j : i)
                 std::cout << ' ' << j;
             std::cout << std::endl;
@@ -0,0 +1,386 @@
+#pragma once
+#include "fwd.hpp"
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace Machine
+{
+    namespace Apparatus
+    {
+        template<class value_t, index_t inline_size = 1>
+        class small_vector_t;
+
+        template<class value_t, index_t inline_size>
+        class small_vector_t
+        {
+            static_assert(inline_size != 0);
+            static_assert(std::is_trivially_copyable_v<value_t>);
+
+        public:
+            using value_type = value_t;
+            using iterator = value_t *;
+            using const_iterator = const value_t *;
+            using reverse_iterator = std::reverse_iterator<iterator>;
+            using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        private:
+            std::unique_ptr<value_t[]> heap_{};
+            index_t size_{0};
+            index_t capacity_{inline_size};
+            std::array<value_t, inline_size> inline_{};
+
+        public:
+            small_vector_t() noexcept = default;
+            ~small_vector_t() = default;
+
+            small_vector_t(const small_vector_t &);
+            small_vector_t &operator=(const small_vector_t &);
+
+            small_vector_t(small_vector_t &&) noexcept;
+            small_vector_t &operator=(small_vector_t &&) noexcept;
+
+            small_vector_t(index_t, const value_t & = value_t{});
+
+        public:
+            bool empty() const noexcept;
+            index_t size() const noexcept;
+            index_t capacity() const noexcept;
+
+            value_t *data() noexcept;
+            const value_t *data() const noexcept;
+
+            value_t &operator[](index_t) noexcept;
+            const value_t &operator[](index_t) const noexcept;
+            value_t &front() noexcept;
+            const value_t &front() const noexcept;
+            value_t &back() noexcept;
+            const value_t &back() const noexcept;
+
+            iterator begin() noexcept;
+            const_iterator begin() const noexcept;
+            const_iterator cbegin() const noexcept;
+            iterator end() noexcept;
+            const_iterator end() const noexcept;
+            const_iterator cend() const noexcept;
+            reverse_iterator rbegin() noexcept;
+            const_reverse_iterator rbegin() const noexcept;
+            const_reverse_iterator crbegin() const noexcept;
+            reverse_iterator rend() noexcept;
+            const_reverse_iterator rend() const noexcept;
+            const_reverse_iterator crend() const noexcept;
+
+            void reserve(index_t);
+            void push_back(const value_t &);
+            value_t &emplace_back(const value_t &);
+            void pop_back() noexcept;
+            void resize(index_t, const value_t & = value_t{});
+            void assign(index_t, const value_t &);
+            template<std::input_iterator iterator_t>
+            void assign(iterator_t, iterator_t);
+            template<std::ranges::input_range range_t>
+            void append_range(range_t &&);
+            iterator erase(const_iterator, const_iterator) noexcept;
+            void clear() noexcept;
+
+            bool operator==(const small_vector_t &) const noexcept;
+            bool operator!=(const small_vector_t &) const noexcept;
+
+            void swap(small_vector_t &) noexcept;
+
+        private:
+            void grow(index_t);
+        };
+
+        template<class value_t, index_t inline_size>
+        void swap(small_vector_t<value_t, inline_size> &,
+            small_vector_t<value_t, inline_size> &) noexcept;
+
+        template<class value_t, index_t inline_size>
+        small_vector_t<value_t, inline_size>::small_vector_t(const small_vector_t &arg)
+        {
+            assign(std::cbegin(arg), std::cend(arg));
+        }
+
+        template<class value_t, index_t inline_size>
+        small_vector_t<value_t, inline_size> &
+            small_vector_t<value_t, inline_size>::operator=(const small_vector_t &arg)
+        {
+            if (this != &arg)
+                assign(std::cbegin(arg), std::cend(arg));
+
+            return *this;
+        }
+
+        template<class value_t, index_t inline_size>
+        small_vector_t<value_t, inline_size>::small_vector_t(small_vector_t &&arg) noexcept :
+            heap_{std::move(arg.heap_)},
+            size_{std::exchange(arg.size_, 0)},
+            capacity_{std::exchange(arg.capacity_, inline_size)},
+            inline_{arg.inline_} {}
+
+        template<class value_t, index_t inline_size>
+        small_vector_t<value_t, inline_size> &
+            small_vector_t<value_t, inline_size>::operator=(small_vector_t &&arg) noexcept
+        {
+            small_vector_t{std::move(arg)}.swap(*this);
+            return *this;
+        }
+
+        template<class value_t, index_t inline_size>
+        small_vector_t<value_t, inline_size>::small_vector_t(index_t size, const value_t &arg)
+        {
+            assign(size, arg);
+        }
+
+        template<class value_t, index_t inline_size>
+        bool small_vector_t<value_t, inline_size>::empty() const noexcept { return size_ == 0; }
+
+        template<class value_t, index_t inline_size>
+        index_t small_vector_t<value_t, inline_size>::size() const noexcept { return size_; }
+
+        template<class value_t, index_t inline_size>
+        index_t small_vector_t<value_t, inline_size>::capacity() const noexcept
+            { return capacity_; }
+
+        template<class value_t, index_t inline_size>
+        value_t *small_vector_t<value_t, inline_size>::data() noexcept
+            { return heap_ ? heap_.get() : std::data(inline_); }
+
+        template<class value_t, index_t inline_size>
+        const value_t *small_vector_t<value_t, inline_size>::data() const noexcept
+            { return heap_ ? heap_.get() : std::data(inline_); }
+
+        template<class value_t, index_t inline_size>
+        value_t &small_vector_t<value_t, inline_size>::operator[](index_t arg) noexcept
+            { return data()[arg]; }
+
+        template<class value_t, index_t inline_size>
+        const value_t &small_vector_t<value_t, inline_size>::operator[](index_t arg) const noexcept
+            { return data()[arg]; }
+
+        template<class value_t, index_t inline_size>
+        value_t &small_vector_t<value_t, inline_size>::front() noexcept { return data()[0]; }
+
+        template<class value_t, index_t inline_size>
+        const value_t &small_vector_t<value_t, inline_size>::front() const noexcept
+            { return data()[0]; }
+
+        template<class value_t, index_t inline_size>
+        value_t &small_vector_t<value_t, inline_size>::back() noexcept
+            { return data()[size_ - 1]; }
+
+        template<class value_t, index_t inline_size>
+        const value_t &small_vector_t<value_t, inline_size>::back() const noexcept
+            { return data()[size_ - 1]; }
+
+        template<class value_t, index_t inline_size>
+        auto small_vector_t<value_t, inline_size>::begin() noexcept -> iterator
+            { return data(); }
+
+        template<class value_t, index_t inline_size>
+        auto small_vector_t<value_t, inline_size>::begin() const noexcept -> const_iterator
+            { return data(); }
+
+        template<class value_t, index_t inline_size>
+        auto small_vector_t<value_t, inline_size>::cbegin() const noexcept -> const_iterator
+            { return data(); }
+
+        template<class value_t, index_t inline_size>
+        auto small_vector_t<value_t, inline_size>::end() noexcept -> iterator
+            { return data() + size_; }
+
+        template<class value_t, index_t inline_size>
+        auto small_vector_t<value_t, inline_size>::end() const noexcept -> const_iterator
+            { return data() + size_; }
+
+        template<class value_t, index_t inline_size>
+        auto small_vector_t<value_t, inline_size>::cend() const noexcept -> const_iterator
+            { return data() + size_; }
+
+        template<class value_t, index_t inline_size>
+        auto small_vector_t<value_t, inline_size>::rbegin() noexcept -> reverse_iterator
+            { return reverse_iterator{end()}; }
+
+        template<class value_t, index_t inline_size>
+        auto small_vector_t<value_t, inline_size>::rbegin() const noexcept
+            -> const_reverse_iterator { return const_reverse_iterator{end()}; }
+
+        template<class value_t, index_t inline_size>
+        auto small_vector_t<value_t, inline_size>::crbegin() const noexcept
+            -> const_reverse_iterator { return const_reverse_iterator{end()}; }
+
+        template<class value_t, index_t inline_size>
+        auto small_vector_t<value_t, inline_size>::rend() noexcept -> reverse_iterator
+            { return reverse_iterator{begin()}; }
+
+        template<class value_t, index_t inline_size>
+        auto small_vector_t<value_t, inline_size>::rend() const noexcept
+            -> const_reverse_iterator { return const_reverse_iterator{begin()}; }
+
+        template<class value_t, index_t inline_size>
+        auto small_vector_t<value_t, inline_size>::crend() const noexcept
+            -> const_reverse_iterator { return const_reverse_iterator{begin()}; }
+
+        template<class value_t, index_t inline_size>
+        void small_vector_t<value_t, inline_size>::reserve(index_t arg)
+        {
+            if (arg > capacity_)
+                grow(arg);
+
+            return;
+        }
+
+        template<class value_t, index_t inline_size>
+        void small_vector_t<value_t, inline_size>::push_back(const value_t &arg)
+        {
+            if (size_ == capacity_)
+                grow(2 * capacity_);
+
+            data()[size_++] = arg;
+
+            return;
+        }
+
+        template<class value_t, index_t inline_size>
+        value_t &small_vector_t<value_t, inline_size>::emplace_back(const value_t &arg)
+        {
+            push_back(arg);
+            return back();
+        }
+
+        template<class value_t, index_t inline_size>
+        void small_vector_t<value_t, inline_size>::pop_back() noexcept
+        {
+            --size_;
+            return;
+        }
+
+        template<class value_t, index_t inline_size>
+        void small_vector_t<value_t, inline_size>::resize(index_t arg, const value_t &value)
+        {
+            if (arg > capacity_)
+                grow(std::max(arg, 2 * capacity_));
+
+            if (arg > size_)
+                std::fill(data() + size_, data() + arg, value);
+
+            size_ = arg;
+
+            return;
+        }
+
+        template<class value_t, index_t inline_size>
+        void small_vector_t<value_t, inline_size>::assign(index_t arg, const value_t &value)
+        {
+            size_ = 0;
+            resize(arg, value);
+
+            return;
+        }
+
+        template<class value_t, index_t inline_size>
+        template<std::input_iterator iterator_t>
+        void small_vector_t<value_t, inline_size>::assign(iterator_t first, iterator_t last)
+        {
+            size_ = 0;
+
+            if constexpr (std::forward_iterator<iterator_t>)
+            {
+                const index_t size = std::distance(first, last);
+                reserve(size);
+                std::copy(first, last, data());
+                size_ = size;
+            }
+            else
+                for (; first != last; ++first)
+                    push_back(*first);
+
+            return;
+        }
+
+        template<class value_t, index_t inline_size>
+        template<std::ranges::input_range range_t>
+        void small_vector_t<value_t, inline_size>::append_range(range_t &&arg)
+        {
+            if constexpr (std::ranges::forward_range<range_t> and
+                std::ranges::sized_range<range_t>)
+            {
+                const index_t size = size_ + std::ranges::size(arg);
+                if (size > capacity_)
+                    grow(std::max(size, 2 * capacity_));
+
+                std::ranges::copy(arg, data() + size_);
+                size_ = size;
+            }
+            else
+                for (auto &&i : arg)
+                    push_back(i);
+
+            return;
+        }
+
+        template<class value_t, index_t inline_size>
+        auto small_vector_t<value_t, inline_size>::erase(const_iterator first,
+            const_iterator last) noexcept -> iterator
+        {
+            iterator ret = begin() + (first - cbegin());
+            std::copy(last, cend(), ret);
+            size_ -= last - first;
+
+            return ret;
+        }
+
+        template<class value_t, index_t inline_size>
+        void small_vector_t<value_t, inline_size>::clear() noexcept
+        {
+            size_ = 0;
+            return;
+        }
+
+        template<class value_t, index_t inline_size>
+        bool small_vector_t<value_t, inline_size>::operator==(const small_vector_t &arg)
+            const noexcept { return std::equal(cbegin(), cend(), arg.cbegin(), arg.cend()); }
+
+        template<class value_t, index_t inline_size>
+        bool small_vector_t<value_t, inline_size>::operator!=(const small_vector_t &arg)
+            const noexcept { return not (*this == arg); }
+
+        template<class value_t, index_t inline_size>
+        void small_vector_t<value_t, inline_size>::swap(small_vector_t &arg) noexcept
+        {
+            using std::swap;
+
+            swap(heap_, arg.heap_);
+            swap(size_, arg.size_);
+            swap(capacity_, arg.capacity_);
+            swap(inline_, arg.inline_);
+
+            return;
+        }
+
+        template<class value_t, index_t inline_size>
+        void small_vector_t<value_t, inline_size>::grow(index_t arg)
+        {
+            std::unique_ptr<value_t[]> heap{std::make_unique_for_overwrite<value_t[]>(arg)};
+            std::copy(cbegin(), cend(), heap.get());
+            heap_ = std::move(heap);
+            capacity_ = arg;
+
+            return;
+        }
+
+        template<class value_t, index_t inline_size>
+        void swap(small_vector_t<value_t, inline_size> &lhs,
+            small_vector_t<value_t, inline_size> &rhs) noexcept
+        {
+            lhs.swap(rhs);
+            return;
+        }
+    }
+}
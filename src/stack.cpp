@@ -41,10 +41,10 @@ namespace Machine
         { return device.encoder()(dynamic_cast<const stack_t &>(device).string()); }
 
     stack_t::stack_t(const stack_t &arg) :
-        device_t{std::unique_ptr<encoder_t>{arg.encoder_->clone()}},
+        device_t{arg.encoder_},
         string_{arg.string_},
-        initialiser_{std::unique_ptr<stack_initialiser_t>{arg.initialiser_->clone()}},
-        terminator_{std::unique_ptr<stack_terminator_t>{arg.terminator_->clone()}}
+        initialiser_{arg.initialiser_},
+        terminator_{arg.terminator_}
     {
         if (not encoder_)
             encoder_.reset(new encoder_ascii_t{});
@@ -73,6 +73,26 @@ namespace Machine
 
     std::string stack_t::print_state() const { return string_.print_state(encoder()); }
 
+    index_t stack_t::n_observations() const
+        { return index_t{encoder().alphabet().max_character()} + 2; }
+
+    index_t stack_t::observation() const { return string_.empty() ? 0 : string_.see() + 1; }
+
+    void stack_t::observe(index_t arg)
+    {
+        string_.clear();
+        if (arg != 0)
+            string_.push(arg - 1);
+
+        return;
+    }
+
+    void stack_t::configuration(std::vector<index_t> &arg) const
+        { return append_configuration(arg, string_); }
+
+    void stack_t::restore_configuration(std::span<const index_t> &arg)
+        { return extract_configuration(arg, string_); }
+
     bool stack_operation_t::correct_device(const device_t &device) const
         { return typeid(device) == typeid(stack_t); }
 
@@ -68,8 +68,8 @@ namespace Machine
     {
     private:
         string_t string_{encoder().alphabet()};
-        std::unique_ptr<stack_initialiser_t> initialiser_;
-        std::unique_ptr<stack_terminator_t> terminator_;
+        std::shared_ptr<const stack_initialiser_t> initialiser_;
+        std::shared_ptr<const stack_terminator_t> terminator_;
 
     public:
         stack_t() = delete;
@@ -92,6 +92,11 @@ namespace Machine
         const stack_terminator_t &terminator() const override;
         std::string print_name() const override;
         std::string print_state() const override;
+        index_t n_observations() const override;
+        index_t observation() const override;
+        void observe(index_t) override;
+        void configuration(std::vector<index_t> &) const override;
+        void restore_configuration(std::span<const index_t> &) override;
     };
 
     class stack_operation_t : public operation_t
@@ -2,6 +2,7 @@
 #include "encoder.hpp"
 
 #include <algorithm>
+#include <bit>
 
 namespace Machine
 {
@@ -12,6 +13,188 @@ namespace Machine
     void alphabet_t::swap(alphabet_t &arg) noexcept
         { std::swap(max_character_, arg.max_character_); }
 
+    namespace Apparatus
+    {
+        packed_vector_t::packed_vector_t(character_t max_character) noexcept :
+            shift_{static_cast<index_t>(std::countr_zero(
+                std::bit_ceil(std::max<index_t>(std::bit_width(max_character), 1))))} {}
+
+        bool packed_vector_t::empty() const noexcept { return size_ == 0; }
+
+        index_t packed_vector_t::size() const noexcept { return size_; }
+
+        index_t packed_vector_t::bits() const noexcept { return index_t{1} << shift_; }
+
+        character_t packed_vector_t::operator[](index_t i) const noexcept
+        {
+            const index_t p = (begin_ + i) << shift_;
+            return (words_[p / n_digits] >> (p % n_digits)) & mask();
+        }
+
+        character_t packed_vector_t::front() const noexcept { return (*this)[0]; }
+
+        character_t packed_vector_t::back() const noexcept { return (*this)[size_ - 1]; }
+
+        void packed_vector_t::set(index_t i, character_t c)
+        {
+            const index_t p = (begin_ + i) << shift_;
+            index_t &word = words_.mutate(p / n_digits);
+
+            word &= ~(mask() << (p % n_digits));
+            word |= index_t{c} << (p % n_digits);
+
+            return;
+        }
+
+        void packed_vector_t::fill(index_t first, index_t last, character_t c)
+        {
+            const index_t p = pattern(c);
+
+            for (index_t b = (begin_ + first) << shift_, e = (begin_ + last) << shift_; b != e;)
+            {
+                const index_t o = b % n_digits;
+                const index_t n = std::min(e - b, n_digits - o);
+                const index_t m = (n == n_digits ? ~index_t{0} : (index_t{1} << n) - 1) << o;
+
+                if ((words_[b / n_digits] & m) != (p & m))
+                {
+                    index_t &word = words_.mutate(b / n_digits);
+                    word = (word & ~m) | (p & m);
+                }
+
+                b += n;
+            }
+
+            return;
+        }
+
+        index_t packed_vector_t::count_forward(index_t first, character_t c) const noexcept
+        {
+            const index_t p = pattern(c);
+            const index_t e = (begin_ + size_) << shift_;
+
+            for (index_t b = (begin_ + first) << shift_; b != e;)
+            {
+                const index_t o = b % n_digits;
+                const index_t n = std::min(e - b, n_digits - o);
+                index_t x = (words_[b / n_digits] ^ p) >> o;
+
+                if (n != n_digits)
+                    x &= (index_t{1} << n) - 1;
+
+                if (x != 0)
+                    return ((b + std::countr_zero(x)) >> shift_) - begin_ - first;
+
+                b += n;
+            }
+
+            return size_ - first;
+        }
+
+        index_t packed_vector_t::count_backward(index_t last, character_t c) const noexcept
+        {
+            const index_t p = pattern(c);
+            const index_t l = begin_ << shift_;
+
+            for (index_t e = (begin_ + last) << shift_; e != l;)
+            {
+                const index_t b = std::max(l, (e - 1) / n_digits * n_digits);
+                const index_t n = e - b;
+                index_t x = (words_[b / n_digits] ^ p) >> (b % n_digits);
+
+                if (n != n_digits)
+                    x &= (index_t{1} << n) - 1;
+
+                if (x != 0)
+                    return begin_ + last - 1 - ((b + std::bit_width(x) - 1) >> shift_);
+
+                e = b;
+            }
+
+            return last;
+        }
+
+        void packed_vector_t::push_back(character_t c)
+        {
+            if (((begin_ + size_) << shift_) % n_digits == 0)
+                words_.push_back(0);
+
+            set(size_++, c);
+
+            return;
+        }
+
+        void packed_vector_t::pop_back()
+        {
+            if (--size_ == 0)
+                return clear();
+
+            if (((begin_ + size_) << shift_) % n_digits == 0)
+                words_.pop_back();
+
+            return;
+        }
+
+        void packed_vector_t::pop_front(index_t n)
+        {
+            if ((size_ -= n) == 0)
+                return clear();
+
+            begin_ += n;
+
+            for (index_t i = (begin_ << shift_) / n_digits; i != 0; --i)
+                words_.pop_front();
+
+            begin_ %= n_digits >> shift_;
+
+            return;
+        }
+
+        void packed_vector_t::resize(index_t new_size, character_t c)
+        {
+            if (new_size == 0)
+                return clear();
+
+            const index_t size = size_;
+            const index_t last =
+                std::min(new_size, ((std::size(words_) * n_digits) >> shift_) - begin_);
+
+            words_.resize((((begin_ + new_size) << shift_) + n_digits - 1) / n_digits, pattern(c));
+            size_ = new_size;
+
+            if (last > size)
+                fill(size, last, c);
+
+            return;
+        }
+
+        void packed_vector_t::clear() noexcept
+        {
+            words_.clear();
+            begin_ = 0;
+            size_ = 0;
+
+            return;
+        }
+
+        void packed_vector_t::swap(packed_vector_t &arg) noexcept
+        {
+            using std::swap;
+
+            swap(words_, arg.words_);
+            swap(begin_, arg.begin_);
+            swap(size_, arg.size_);
+            swap(shift_, arg.shift_);
+
+            return;
+        }
+
+        index_t packed_vector_t::mask() const noexcept { return (index_t{1} << bits()) - 1; }
+
+        index_t packed_vector_t::pattern(character_t c) const noexcept
+            { return ~index_t{0} / mask() * c; }
+    }
+
     string_t::string_character_proxy_t::string_character_proxy_t(string_t *ptr, index_t pos)
         noexcept : ptr_{ptr}, pos_{pos} {}
 
@@ -35,7 +218,7 @@ namespace Machine
             throw std::runtime_error{"In Machine::string_t::string_character_proxy_t::"
                 "operator=(character_t):\nInvalid character\n"};
 
-        ptr_->string_[pos_] = c;
+        ptr_->string_.set(pos_, c);
 
         return *this;
     }
@@ -73,10 +256,10 @@ namespace Machine
         return *this;
     }
 
-    string_t::string_t() noexcept(noexcept(std::vector<character_t>())) {}
+    string_t::string_t() noexcept {}
 
-    string_t::string_t(const alphabet_t &alphabet) noexcept(noexcept(std::vector<character_t>())) :
-        alphabet_{alphabet} {}
+    string_t::string_t(const alphabet_t &alphabet) noexcept :
+        alphabet_{alphabet}, string_{alphabet.max_character()} {}
 
     bool string_t::empty() const noexcept { return pos_ == negative_1; }
 
@@ -172,7 +355,99 @@ namespace Machine
             throw std::runtime_error{"In Machine::string_t::print(character_t) const:\n"
                 "Print past end of file.\n"};
 
-        string_[pos_] = c;
+        string_.set(pos_, c);
+
+        return;
+    }
+
+    character_t string_t::pop_unchecked()
+    {
+        character_t ret = string_.back();
+        string_.pop_back();
+        --pos_;
+
+        return ret;
+    }
+
+    void string_t::push_unchecked(character_t c)
+    {
+        string_.push_back(c);
+        ++pos_;
+
+        return;
+    }
+
+    void string_t::move_r_unchecked(character_t c)
+    {
+        if (pos_ == std::size(string_) - 1)
+            string_.push_back(c);
+        ++pos_;
+
+        return;
+    }
+
+    void string_t::print_unchecked(character_t c)
+    {
+        if (string_[pos_] != c)
+            string_.set(pos_, c);
+
+        return;
+    }
+
+    index_t string_t::run_forward(character_t c) const noexcept
+        { return pos_ == negative_1 ? 0 : string_.count_forward(pos_, c); }
+
+    index_t string_t::run_backward(character_t c) const noexcept
+        { return string_.count_backward(pos_ + 1, c); }
+
+    index_t string_t::run_backward(character_t c, index_t last) const noexcept
+        { return string_.count_backward(last, c); }
+
+    void string_t::pop_unchecked(index_t n)
+    {
+        string_.resize(std::size(string_) - n, 0);
+        pos_ -= n;
+
+        return;
+    }
+
+    void string_t::push_unchecked(character_t c, index_t n)
+    {
+        string_.resize(std::size(string_) + n, c);
+        pos_ += n;
+
+        return;
+    }
+
+    void string_t::move_l_unchecked(index_t n)
+    {
+        pos_ -= n;
+        return;
+    }
+
+    void string_t::move_r_unchecked(character_t c, index_t n)
+    {
+        if (pos_ + n >= std::size(string_))
+            string_.resize(pos_ + n + 1, c);
+        pos_ += n;
+
+        return;
+    }
+
+    void string_t::print_l_unchecked(character_t c, index_t n)
+    {
+        string_.fill(pos_ + 1 - n, pos_ + 1, c);
+        pos_ -= n;
+
+        return;
+    }
+
+    void string_t::print_r_unchecked(character_t c, character_t d, index_t n)
+    {
+        const index_t pos = pos_;
+
+        move_r_unchecked(d, n);
+        string_.fill(pos, pos + n, c);
 
         return;
     }
@@ -185,8 +460,8 @@ namespace Machine
     {
         std::string ret{};
 
-        for (auto i = std::cbegin(string_); i != std::cend(string_); ++i)
-            ret.push_back(encoder(*i));
+        for (index_t i = 0; i != std::size(string_); ++i)
+            ret.push_back(encoder(string_[i]));
 
         return ret;
     }
@@ -195,8 +470,8 @@ namespace Machine
     {
         std::string ret{};
 
-        for (auto i = std::crbegin(string_); i != std::crend(string_); ++i)
-            ret.push_back(encoder(*i));
+        for (index_t i = std::size(string_); i != 0; --i)
+            ret.push_back(encoder(string_[i - 1]));
 
         return ret;
     }
@@ -221,20 +496,20 @@ namespace Machine
             "\nThe strings have different alphabet.\n"};
 
 
-        for(auto i = std::crbegin(string_), j = std::crbegin(arg.string_); ;++i, ++j)
+        for(index_t i = std::size(string_), j = std::size(arg.string_); ; --i, --j)
         {
-            if (i == std::crend(string_))
+            if (i == 0)
             {
-                if (j == std::crend(arg.string_))
+                if (j == 0)
                     return std::strong_ordering::equivalent;
                 return std::strong_ordering::less;
             }
-            if (j == std::crend(arg.string_))
+            if (j == 0)
                 return std::strong_ordering::greater;
 
-            if (*i < *j)
+            if (string_[i - 1] < arg.string_[j - 1])
                 return std::strong_ordering::less;
-            if (*j < *i)
+            if (arg.string_[j - 1] < string_[i - 1])
                 return std::strong_ordering::greater;
         }
     }
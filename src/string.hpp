@@ -1,9 +1,11 @@
 #pragma once
 #include "fwd.hpp"
+#include "cow.hpp"
 
 #include <vector>
 #include <stdexcept>
 #include <compare>
+#include <limits>
 
 namespace Machine
 {
@@ -14,6 +16,8 @@ namespace Machine
     {
         template<integer_t stride, bool is_const>
         class string_iterator_template_t;
+
+        class packed_vector_t;
     }
 
     using string_iterator_t = Apparatus::string_iterator_template_t<1, false>;
@@ -37,6 +41,57 @@ namespace Machine
 
     class encoder_t;
 
+    namespace Apparatus
+    {
+        class packed_vector_t
+        {
+        private:
+            static constexpr index_t n_digits = std::numeric_limits<index_t>::digits;
+
+            cow_vector_t<index_t, 64> words_{};
+            index_t begin_{0};
+            index_t size_{0};
+            index_t shift_{0};
+
+        public:
+            packed_vector_t() noexcept = default;
+            ~packed_vector_t() = default;
+
+            packed_vector_t(const packed_vector_t &) noexcept = default;
+            packed_vector_t &operator=(const packed_vector_t &) noexcept = default;
+
+            packed_vector_t(packed_vector_t &&) noexcept = default;
+            packed_vector_t &operator=(packed_vector_t &&) noexcept = default;
+
+            packed_vector_t(character_t) noexcept;
+
+        public:
+            bool empty() const noexcept;
+            index_t size() const noexcept;
+            index_t bits() const noexcept;
+
+            character_t operator[](index_t) const noexcept;
+            character_t front() const noexcept;
+            character_t back() const noexcept;
+            void set(index_t, character_t);
+            void fill(index_t, index_t, character_t);
+            index_t count_forward(index_t, character_t) const noexcept;
+            index_t count_backward(index_t, character_t) const noexcept;
+
+            void push_back(character_t);
+            void pop_back();
+            void pop_front(index_t = 1);
+            void resize(index_t, character_t);
+            void clear() noexcept;
+
+            void swap(packed_vector_t &) noexcept;
+
+        private:
+            index_t mask() const noexcept;
+            index_t pattern(character_t) const noexcept;
+        };
+    }
+
     class string_t
     {
         template<index_t stride, bool is_const>
@@ -143,12 +198,12 @@ namespace Machine
 
     private:
         alphabet_t alphabet_{0};
-        std::vector<character_t> string_{};
+        Apparatus::packed_vector_t string_{};
         index_t pos_{std::size(string_) - 1};
 
     public:
-        string_t() noexcept(noexcept(std::vector<character_t>()));
-        string_t(const alphabet_t &) noexcept(noexcept(std::vector<character_t>()));
+        string_t() noexcept;
+        string_t(const alphabet_t &) noexcept;
 
     public:
         bool empty() const noexcept;
@@ -167,6 +222,21 @@ namespace Machine
         void move_r(character_t);
         void print(character_t);
 
+        character_t pop_unchecked();
+        void push_unchecked(character_t);
+        void move_r_unchecked(character_t);
+        void print_unchecked(character_t);
+
+        index_t run_forward(character_t) const noexcept;
+        index_t run_backward(character_t) const noexcept;
+        index_t run_backward(character_t, index_t) const noexcept;
+        void pop_unchecked(index_t);
+        void push_unchecked(character_t, index_t);
+        void move_l_unchecked(index_t);
+        void move_r_unchecked(character_t, index_t);
+        void print_l_unchecked(character_t, index_t);
+        void print_r_unchecked(character_t, character_t, index_t);
+
         string_t &clear() noexcept;
 
         const alphabet_t &alphabet() const noexcept;
@@ -67,11 +67,11 @@ namespace Machine
     }
 
     tape_t::tape_t(const tape_t &arg) :
-        device_t{std::unique_ptr<encoder_t>{arg.encoder().clone()}},
+        device_t{arg.encoder_},
         string_{arg.string_},
         default_character_{arg.default_character_},
-        initialiser_{arg.initialiser_->clone()},
-        terminator_{arg.terminator_->clone()} {}
+        initialiser_{arg.initialiser_},
+        terminator_{arg.terminator_} {}
 
     tape_t &tape_t::operator=(const tape_t &arg) { return *this = tape_t{arg}; }
 
@@ -112,6 +112,41 @@ namespace Machine
         return ret;
     }
 
+    index_t tape_t::n_observations() const
+        { return 2 * (index_t{encoder().alphabet().max_character()} + 1); }
+
+    index_t tape_t::observation() const
+        { return 2 * index_t{string_.see()} + (string_.athome() ? 1 : 0); }
+
+    void tape_t::observe(index_t arg)
+    {
+        string_.clear();
+        string_.push(arg / 2);
+        if (arg % 2 == 0)
+            string_.push(arg / 2);
+
+        return;
+    }
+
+    void tape_t::configuration(std::vector<index_t> &arg) const
+    {
+        index_t n = std::size(string_);
+
+        while (n > string_.pos() + 1 and string_[n - 1] == default_character_)
+            --n;
+
+        arg.emplace_back(n);
+        arg.emplace_back(string_.pos());
+
+        for (index_t i = 0; i != n; ++i)
+            arg.emplace_back(string_[i]);
+
+        return;
+    }
+
+    void tape_t::restore_configuration(std::span<const index_t> &arg)
+        { return extract_configuration(arg, string_); }
+
     bool tape_operation_t::correct_device(const device_t &device) const
         { return typeid(device) == typeid(tape_t); }
 
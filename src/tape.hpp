@@ -71,8 +71,8 @@ namespace Machine
     private:
         string_t string_{encoder().alphabet()};
         character_t default_character_;
-        std::unique_ptr<tape_initialiser_t> initialiser_;
-        std::unique_ptr<tape_terminator_t> terminator_;
+        std::shared_ptr<const tape_initialiser_t> initialiser_;
+        std::shared_ptr<const tape_terminator_t> terminator_;
 
     public:
         tape_t() = delete;
@@ -96,6 +96,11 @@ namespace Machine
         const tape_terminator_t &terminator() const override;
         std::string print_name() const override;
         std::string print_state() const override;
+        index_t n_observations() const override;
+        index_t observation() const override;
+        void observe(index_t) override;
+        void configuration(std::vector<index_t> &) const override;
+        void restore_configuration(std::span<const index_t> &) override;
     };
 
     class tape_operation_t : public operation_t
@@ -42,9 +42,9 @@ namespace Machine
     }
 
     unsigned_counter_t::unsigned_counter_t(const unsigned_counter_t &arg) :
-        device_t{std::unique_ptr<encoder_t>(arg.encoder_->clone())},
-        initialiser_{arg.initialiser_->clone()},
-        terminator_{arg.terminator_->clone()},
+        device_t{arg.encoder_},
+        initialiser_{arg.initialiser_},
+        terminator_{arg.terminator_},
         state_{arg.state_} {}
 
     unsigned_counter_t &unsigned_counter_t::operator=(const unsigned_counter_t &arg)
@@ -70,6 +70,18 @@ namespace Machine
 
     std::string unsigned_counter_t::print_state() const { return state_.print(encoder()); }
 
+    index_t unsigned_counter_t::n_observations() const { return 2; }
+
+    index_t unsigned_counter_t::observation() const { return state_.zero() ? 0 : 1; }
+
+    void unsigned_counter_t::observe(index_t arg) { state_ = arg; return; }
+
+    void unsigned_counter_t::configuration(std::vector<index_t> &arg) const
+        { return append_configuration(arg, state_); }
+
+    void unsigned_counter_t::restore_configuration(std::span<const index_t> &arg)
+        { return extract_configuration(arg, state_); }
+
     unsigned_number_t &unsigned_counter_t::state() { return state_; }
 
     const unsigned_number_t &unsigned_counter_t::state() const { return state_; }
@@ -72,8 +72,8 @@ namespace Machine
     class unsigned_counter_t final : public device_t
     {
     private:
-        std::unique_ptr<unsigned_counter_initialiser_t> initialiser_;
-        std::unique_ptr<unsigned_counter_terminator_t> terminator_;
+        std::shared_ptr<const unsigned_counter_initialiser_t> initialiser_;
+        std::shared_ptr<const unsigned_counter_terminator_t> terminator_;
         unsigned_number_t state_{};
 
     public:
@@ -97,6 +97,11 @@ namespace Machine
         const unsigned_counter_terminator_t &terminator() const override;
         std::string print_name() const override;
         std::string print_state() const override;
+        index_t n_observations() const override;
+        index_t observation() const override;
+        void observe(index_t) override;
+        void configuration(std::vector<index_t> &) const override;
+        void restore_configuration(std::span<const index_t> &) override;
 
         unsigned_number_t &state();
         const unsigned_number_t &state() const;
@@ -0,0 +1,216 @@
+#!/bin/bash
+# Checks of the exploration of nondeterministic programs by the console.
+# Run from any directory once the run executable is built at the root of the repository.
+
+cd "$(dirname "$0")"
+
+run=../../run
+chapter=../../the_language_of_machines/chapter_1
+result=0
+
+# Programs whose every computation halts or blocks, each with some inputs on which one halts
+programs=(
+    "${chapter}/example_16/program abba abbbba"
+    "${chapter}/example_18/program aabb aabbbb"
+    "${chapter}/example_19/program aabbc abbcc"
+    "${chapter}/example_20/program abbba#baaaa"
+    "${chapter}/exercice_9_4/program abbbab"
+    "${chapter}/exercice_10_4/program abab"
+    "subsequences abbab"
+    "partial_sums aaaaaaa"
+)
+
+# Prints the output classes found by run, sorted
+classes()
+{
+    ${run} "$@" -nph -vo -t 60 | grep $'^\t' | sort
+    return 0
+}
+
+# Prints the number preceding the given text in the report of run
+counter()
+{
+    local text=$1
+    shift
+    ${run} "$@" -nph -vo -t 60 | grep "${text}" | awk '{print $1}'
+    return 0
+}
+
+# Compares the output classes of a reference run with those of run with additional arguments
+check()
+{
+    local program=$1
+    local input=$2
+    shift 2
+
+    local expected
+    local obtained
+    expected=$(classes -p ${program} -i ${input})
+    obtained=$(classes -p ${program} -i ${input} "$@")
+
+    if [ -z "${expected}" ]
+    then
+        result=1
+        echo "No output class found by ${run} -p ${program} -i ${input}"
+    fi
+
+    if [ "${expected}" != "${obtained}" ]
+    then
+        result=1
+        echo "The following test did not succeed:"
+        echo "${run} -p ${program} -i ${input} $*"
+    fi
+
+    return 0
+}
+
+# Deduplication does not change the output classes
+for i in "${programs[@]}"
+do
+    set -- ${i}
+    program=$1
+    shift
+    for input in "$@"
+    do
+        check ${program} ${input} -u
+        check ${program} ${input} -u -nt 1
+    done
+done
+
+# Every exploration strategy finds the same output classes, with and without deduplication
+for i in "${programs[@]}"
+do
+    set -- ${i}
+    program=$1
+    shift
+    for input in "$@"
+    do
+        for strategy in dfs id bf
+        do
+            check ${program} ${input} -s ${strategy}
+            check ${program} ${input} -s ${strategy} -u
+            check ${program} ${input} -s ${strategy} -nt 1
+        done
+        check ${program} ${input} -s bf -pr size
+    done
+done
+
+# A configuration first reached along a longer path is explored again when reached in fewer steps
+for strategy in dfs id
+do
+    ${run} -p shortcut -i \\ -s ${strategy} -db 6 -u -nt 1 -o Accept
+    if [ ! "$?" = 0 ]
+    then
+        result=1
+        echo "The following test did not succeed:"
+        echo "${run} -p shortcut -i \\\\ -s ${strategy} -db 6 -u -nt 1 -o Accept"
+    fi
+done
+
+# Spilling the machines beyond the frontier cap to disk and reading them back finds the same output
+# classes
+for i in "${programs[@]}"
+do
+    set -- ${i}
+    program=$1
+    shift
+    for input in "$@"
+    do
+        for strategy in bfs dfs id bf
+        do
+            check ${program} ${input} -s ${strategy} -mf 2
+            check ${program} ${input} -s ${strategy} -mf 2 -u
+        done
+    done
+done
+
+reference=$(classes -p subsequences -i abbab)
+
+for strategy in bfs dfs id bf
+do
+    spilled=$(counter "spilled machines" -p subsequences -i abbab -s ${strategy} -mf 2)
+    if [ -z "${spilled}" ] || [ "${spilled}" = 0 ]
+    then
+        result=1
+        echo "No machine spilled by ${run} -p subsequences -i abbab -s ${strategy} -mf 2"
+    fi
+
+    # Discarding them instead finds some of the output classes
+    dropped=$(counter "dropped machines" -p subsequences -i abbab -s ${strategy} -mf 2 -ov prune)
+    obtained=$(classes -p subsequences -i abbab -s ${strategy} -mf 2 -ov prune)
+    if [ -z "${dropped}" ] || [ "${dropped}" = 0 ] || [ -z "${obtained}" ] ||
+       [ -n "$(comm -13 <(echo "${reference}") <(echo "${obtained}"))" ]
+    then
+        result=1
+        echo "The following test did not succeed:"
+        echo "${run} -p subsequences -i abbab -s ${strategy} -mf 2 -ov prune"
+    fi
+done
+
+# Deduplication prunes the computations that reach the same configuration
+pruned=$(counter "pruned machines" -p partial_sums -i aaaaaaa -u)
+if [ -z "${pruned}" ] || [ "${pruned}" = 0 ]
+then
+    result=1
+    echo "No machine pruned by ${run} -p partial_sums -i aaaaaaa -u"
+fi
+
+# -vc prints the same output classes as -vo, each preceded by its number of halted machines
+expected=$(classes -p subsequences -i abbab)
+obtained=$(${run} -p subsequences -i abbab -nph -vc -t 60 | grep $'^\t' | sort)
+if [ "${expected}" != "$(echo "${obtained}" | sed 's/^\t[1-9][0-9]*:/\t/' | sort)" ] ||
+   [ -n "$(echo "${obtained}" | grep -v $'^\t[1-9][0-9]*: ')" ]
+then
+    result=1
+    echo "The following test did not succeed:"
+    echo "${run} -p subsequences -i abbab -vc"
+fi
+
+# The batch mode prints one line per input, empty lines included, with the return value of its run
+for i in "${programs[@]}"
+do
+    set -- ${i}
+    program=$1
+    shift
+    expected=""
+    for input in "$@" \\ "$@"
+    do
+        ${run} -p ${program} -i ${input} -o Accept -nph -t 60
+        expected+="${input}"$'\t'"$?"$'\n'
+    done
+    obtained=$(printf '%s\n' "$@" "" "$@" | ${run} -p ${program} -b -o Accept -t 60)
+    if [ "${expected%$'\n'}" != "${obtained}" ]
+    then
+        result=1
+        echo "The following test did not succeed:"
+        echo "${run} -p ${program} -b -o Accept"
+    fi
+done
+
+# An input out of the alphabet is not valid and a depth bound leaves the longer computations unfinished
+expected=$(printf 'aabbc\t0\nxyz\t9\n')
+obtained=$(printf 'aabbc\nxyz\n' | ${run} -p ${chapter}/example_19/program -b -o Accept -u)
+if [ "${expected}" != "${obtained}" ]
+then
+    result=1
+    echo "The following test did not succeed:"
+    echo "${run} -p ${chapter}/example_19/program -b -o Accept -u"
+fi
+
+expected=$(printf 'aabbc\t7\n')
+obtained=$(printf 'aabbc\n' | ${run} -p ${chapter}/example_19/program -b -o Accept -db 3)
+if [ "${expected}" != "${obtained}" ]
+then
+    result=1
+    echo "The following test did not succeed:"
+    echo "${run} -p ${chapter}/example_19/program -b -o Accept -db 3"
+fi
+
+if [ $result = 0 ]
+then
+    echo "All tests succeded"
+else
+    echo "Some tests did not succeed"
+fi
+
+exit ${result}
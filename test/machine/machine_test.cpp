@@ -0,0 +1,127 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+
+#include "machine.hpp"
+
+using namespace Machine;
+
+// Checks that the macro steps and fused loops of run() and next(index_t) go through the same
+// computation as single steps of next(): every line of machine_test.dat names a program and an input
+// whose computation sweeps long runs of a device, optionally followed by the number of times that
+// run() fuses each loop of the program.
+
+int main()
+{
+    std::ifstream data{"machine_test.dat"};
+    std::string line;
+    int line_counter = 0;
+    int error = 0;
+
+    auto check = [&](const auto &arg0, const auto &arg1, const char *what) -> void
+    {
+        if (arg0 != arg1)
+        {
+            error = 1;
+            std::cerr << "Failed test in line " << line_counter << ": " << what << std::endl;
+        }
+
+        return;
+    };
+
+    auto check_machines = [&](const machine_t &a, const machine_t &b, bool log) -> void
+    {
+        check(a.state(), b.state(), "state");
+        check(a.output(), b.output(), "output");
+        check(a.configuration(), b.configuration(), "configuration");
+        check(a.computation_size(), b.computation_size(), "computation size");
+
+        if (log and a.computation_size() == b.computation_size())
+            for (index_t i = 0; i != a.computation_size(); ++i)
+                if (a.computation(i) != b.computation(i))
+                {
+                    check(a.computation(i), b.computation(i), "computation");
+                    break;
+                }
+
+        return;
+    };
+
+    while (std::getline(data, line))
+    {
+        ++line_counter;
+
+        if (std::empty(line) or not (line.front() == '.' or (line.front() >= 'a' and
+                line.front() <= 'z')))
+            continue;
+
+        std::istringstream stream{line};
+        std::string path;
+        std::string input;
+        std::vector<index_t> fired;
+
+        stream >> path >> input;
+        for (index_t i; stream >> i;)
+            fired.emplace_back(i);
+
+        if (input == "\\")
+            input.clear();
+
+        std::ifstream program{path};
+        machine_t single{program};
+        single.initialise(input);
+
+        // Each machine loaded from the file has its own program, so only this run() is counted
+        if (not std::empty(fired))
+        {
+            program.clear();
+            program.seekg(0);
+            machine_t fused{program};
+            fused.initialise(input);
+            fused.run();
+
+            std::vector<index_t> obtained;
+            for (const std::string &i : fused.print_fusions())
+                obtained.emplace_back(std::stoul(i.substr(i.rfind("fired ") + 6)));
+
+            check(obtained, fired, "fused loops");
+        }
+
+        if (not single.deterministic())
+        {
+            check(single.deterministic(), true, "deterministic");
+            continue;
+        }
+
+        machine_t macro{single};
+        std::vector<machine_t> chunked(3, single);
+        const index_t chunks[] = {1, 3, 64};
+
+        macro.run();
+
+        for (index_t i = 0; single.state() == machine_t::machine_state_t::running; ++i)
+        {
+            // A chunk of next(k) must stop exactly after k steps, even within a run
+            for (index_t j = 0; j != std::size(chunked); ++j)
+                if (i % chunks[j] == 0)
+                {
+                    check_machines(chunked[j], single, false);
+                    chunked[j].next(chunks[j]);
+                }
+
+            single.next();
+        }
+
+        check_machines(macro, single, true);
+
+        for (const machine_t &m : chunked)
+            check_machines(m, single, true);
+    }
+
+    if (line_counter == 0)
+        return 2;
+
+    return error;
+}
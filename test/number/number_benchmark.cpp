@@ -0,0 +1,114 @@
+#include <iostream>
+#include <string>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <limits>
+#include <array>
+
+#include "string.hpp"
+#include "encoder.hpp"
+#include "number.hpp"
+
+using namespace Machine;
+
+// Times the products of random factors of 16 to 16384 words, which is how the Karatsuba and Toom-3
+// thresholds of number.cpp were chosen, and the quotients of 2n by n words that place the
+// Burnikel-Ziegler threshold. The thresholds can be overridden when building it, as in
+//     make number_benchmark BENCHMARK_FLAGS="-DMACHINE_KARATSUBA_THRESHOLD=48"
+// and comparing the timings of two builds shows where one algorithm starts to beat the other.
+// Building it against the sources of an older revision compares two implementations, as in
+//     git worktree add /tmp/old <revision> && make number_benchmark SRC_DIR=/tmp/old/src/
+
+static constexpr index_t word_digits = std::numeric_limits<index_t>::digits / 4;
+
+// The best time of one call to f over five rounds, each one repeating f for at least 20 ms
+template<typename function_t>
+static double best_of_5(function_t f)
+{
+    using clock_t = std::chrono::steady_clock;
+    double best = std::numeric_limits<double>::max();
+
+    for (int round = 0; round != 5; ++round)
+    {
+        const clock_t::time_point start = clock_t::now();
+        index_t repetitions = 0;
+        std::chrono::duration<double> elapsed;
+
+        do
+        {
+            f();
+            ++repetitions;
+            elapsed = clock_t::now() - start;
+        } while (elapsed < std::chrono::milliseconds{20});
+
+        best = std::min(best, elapsed.count() / repetitions);
+    }
+
+    return best;
+}
+
+int main()
+{
+    std::mt19937_64 generator{0};
+    const encoder_b_ary_t hexadecimal{16};
+
+    // A random number of exactly n words
+    auto random = [&](index_t n) -> unsigned_number_t
+    {
+        std::string s(n * word_digits, '0');
+        for (char &c : s)
+            c = "0123456789abcdef"[generator() % 16];
+        s.front() = "123456789abcdef"[generator() % 15];
+
+        return unsigned_number_t{s, hexadecimal};
+    };
+
+    std::cout << "words\tmultiplication (us)" << std::endl;
+
+    for (index_t n = 16; n <= 16384; n *= 2)
+        for (index_t m : {n, n + n / 2})
+        {
+            if (m > 16384)
+                continue;
+
+            const unsigned_number_t a = random(m);
+            const unsigned_number_t b = random(m);
+            unsigned_number_t c;
+
+            std::cout << m << '\t' << best_of_5([&]() { c = a * b; }) * 1e6 << std::endl;
+        }
+
+    std::cout << "\nwords\tdivision (us)" << std::endl;
+
+    // The shapes quoted when the reciprocal divisions replaced the hardware division per word
+    {
+        const unsigned_number_t a = random(1000);
+        const index_t b = generator() | 1;
+        std::array<unsigned_number_t, 2> c;
+
+        std::cout << "1000/1\t" << best_of_5([&]() { c = divide(a, b); }) * 1e6 << std::endl;
+    }
+
+    for (index_t n : {50, 1000})
+    {
+        const unsigned_number_t a = random(2 * n);
+        const unsigned_number_t b = random(n);
+        std::array<unsigned_number_t, 2> c;
+
+        std::cout << 2 * n << '/' << n << '\t' << best_of_5([&]() { c = divide(a, b); }) * 1e6 <<
+            std::endl;
+    }
+
+    for (index_t n = 32; n <= 4096; n *= 2)
+    {
+        const unsigned_number_t a = random(2 * n);
+        const unsigned_number_t b = random(n);
+        std::array<unsigned_number_t, 2> c;
+
+        std::cout << 2 * n << '/' << n << '\t' << best_of_5([&]() { c = divide(a, b); }) * 1e6 <<
+            std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,179 @@
+#include <iostream>
+#include <deque>
+#include <random>
+#include <algorithm>
+#include <limits>
+
+#include "string.hpp"
+
+using namespace Machine;
+using Apparatus::packed_vector_t;
+
+// Applies the same random operations to a packed_vector_t and to a std::deque and compares them
+// after each one, for every width of the packed characters and every offset of the first one
+// inside its word. The characters are drawn from a few values so that long runs appear.
+
+int main()
+{
+    std::mt19937_64 generator{0};
+    int error = 0;
+
+    auto random = [&generator](index_t n) -> index_t
+        { return std::uniform_int_distribution<index_t>{0, n - 1}(generator); };
+
+    for (character_t max_character : {1, 3, 15, 255, 65535})
+    {
+        const index_t per_word = std::numeric_limits<index_t>::digits /
+            packed_vector_t{max_character}.bits();
+        const character_t characters[] = {0, 1, static_cast<character_t>(max_character / 3),
+            max_character};
+
+        auto character = [&]() -> character_t
+            { return characters[random(std::size(characters))]; };
+
+        for (index_t offset = 0; offset != per_word; ++offset)
+        {
+            packed_vector_t packed{max_character};
+            std::deque<character_t> reference;
+            index_t operation = 0;
+
+            auto report = [&](const char *what) -> void
+            {
+                error = 1;
+                std::cerr << "Failed test with maximum character " << max_character <<
+                    ", offset " << offset << ", operation " << operation << ": " << what <<
+                    std::endl;
+
+                return;
+            };
+
+            auto compare = [&](const packed_vector_t &a, const std::deque<character_t> &b,
+                const char *what) -> bool
+            {
+                bool ret = std::size(a) == std::size(b);
+
+                for (index_t i = 0; ret and i != std::size(b); ++i)
+                    ret = a[i] == b[i];
+
+                if (not ret)
+                    report(what);
+
+                return ret;
+            };
+
+            auto check = [&](const char *what) -> bool { return compare(packed, reference, what); };
+
+            // Leaves the first character at the given position of its word
+            packed.resize(offset + 1, 0);
+            packed.pop_front(offset);
+            reference.assign(1, 0);
+
+            if (not check("offset"))
+                continue;
+
+            for (; operation != 2000; ++operation)
+            {
+                const packed_vector_t copy{packed};
+                const std::deque<character_t> copy_reference{reference};
+                const index_t size = std::size(reference);
+
+                switch (random(8))
+                {
+                    case 0:
+                    {
+                        const character_t c = character();
+                        for (index_t n = random(3 * per_word); n != 0; --n)
+                        {
+                            packed.push_back(c);
+                            reference.push_back(c);
+                        }
+                        break;
+                    }
+
+                    case 1:
+                        if (size != 0)
+                        {
+                            packed.pop_back();
+                            reference.pop_back();
+                        }
+                        break;
+
+                    case 2:
+                    {
+                        const index_t n = random(std::min(size, 3 * per_word) + 1);
+                        if (n != 0)
+                            packed.pop_front(n);
+                        reference.erase(std::begin(reference), std::begin(reference) + n);
+                        break;
+                    }
+
+                    case 3:
+                    {
+                        const index_t n = random(size + 3 * per_word + 1);
+                        const character_t c = character();
+                        packed.resize(n, c);
+                        reference.resize(n, c);
+                        break;
+                    }
+
+                    case 4:
+                        if (size != 0)
+                        {
+                            index_t first = random(size + 1);
+                            index_t last = random(size + 1);
+                            if (first > last)
+                                std::swap(first, last);
+                            const character_t c = character();
+                            packed.fill(first, last, c);
+                            std::fill(std::begin(reference) + first,
+                                std::begin(reference) + last, c);
+                        }
+                        break;
+
+                    case 5:
+                        if (size != 0)
+                        {
+                            const index_t i = random(size);
+                            const character_t c = character();
+                            packed.set(i, c);
+                            reference[i] = c;
+                        }
+                        break;
+
+                    case 6:
+                    {
+                        const index_t first = random(size + 1);
+                        const character_t c = character();
+                        const index_t n = std::find_if(std::begin(reference) + first,
+                            std::end(reference), [c](character_t i) { return i != c; }) -
+                            std::begin(reference) - first;
+                        if (packed.count_forward(first, c) != n)
+                            report("count_forward");
+                        break;
+                    }
+
+                    case 7:
+                    {
+                        const index_t last = random(size + 1);
+                        const character_t c = character();
+                        const index_t n = std::find_if(std::rbegin(reference) + (size - last),
+                            std::rend(reference), [c](character_t i) { return i != c; }) -
+                            std::rbegin(reference) - (size - last);
+                        if (packed.count_backward(last, c) != n)
+                            report("count_backward");
+                        break;
+                    }
+                }
+
+                if (not check("contents"))
+                    break;
+
+                // The copy taken before the operation shared the words that it modified
+                if (not compare(copy, copy_reference, "copy"))
+                    break;
+            }
+        }
+    }
+
+    return error;
+}